@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Benchmark.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+
+namespace Dataplex
+{
+    namespace benchmark
+    {
+        struct Options
+        {
+            std::size_t maxThreads = 64;
+            std::size_t operations = 1 << 20;
+        };
+
+        Options parse_options(int argc, char** argv);
+
+        std::vector<std::size_t> thread_counts(std::size_t maxThreads);
+
+        template<typename Function>
+        double run_threads(std::size_t threadCount, Function function);
+
+        void print_header(const std::string& title);
+        void print_result(const std::string& name, std::size_t threadCount, std::size_t operations, double seconds);
+    }
+}
+
+inline Dataplex::benchmark::Options Dataplex::benchmark::parse_options(int argc, char** argv)
+{
+    Options options;
+
+    if (argc > 1)
+    {
+        options.maxThreads = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    if (argc > 2)
+    {
+        options.operations = std::strtoull(argv[2], nullptr, 10);
+    }
+
+    return options;
+}
+
+inline std::vector<std::size_t> Dataplex::benchmark::thread_counts(std::size_t maxThreads)
+{
+    std::vector<std::size_t> counts;
+
+    for (std::size_t count = 1; count <= maxThreads; count *= 2)
+    {
+        counts.push_back(count);
+    }
+
+    return counts;
+}
+
+template<typename Function>
+double Dataplex::benchmark::run_threads(std::size_t threadCount, Function function)
+{
+    std::atomic<std::size_t> ready(0);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+            {
+                ready.fetch_add(1);
+
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+
+                function(i);
+            });
+    }
+
+    while (ready.load() != threadCount)
+    {
+        std::this_thread::yield();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+
+    start.store(true);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+inline void Dataplex::benchmark::print_header(const std::string& title)
+{
+    std::cout << title << '\n'
+        << std::left << std::setw(28) << "variant" << std::right << std::setw(8) << "threads"
+        << std::setw(16) << "Mops/s" << '\n';
+}
+
+inline void Dataplex::benchmark::print_result(const std::string& name, std::size_t threadCount, std::size_t operations, double seconds)
+{
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(8) << threadCount
+        << std::setw(16) << std::fixed << std::setprecision(2) << operations / seconds / 1e6 << '\n';
+}
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentPriorityQueueBenchmark.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Benchmark.hpp"
+
+#include "ConcurrentPriorityQueue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+    constexpr std::size_t PrefillCount = 1 << 16;
+
+    std::uint64_t next_random(std::uint64_t& seed)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        return seed;
+    }
+
+    template<typename Queue>
+    double churn(Queue& queue, std::size_t threadCount, std::size_t operations)
+    {
+        std::uint64_t seed = 0x2545F4914F6CDD1D;
+
+        for (std::size_t i = 0; i < PrefillCount; ++i)
+        {
+            queue.push(next_random(seed));
+        }
+
+        std::atomic<std::uint64_t> sink(0);
+
+        return Dataplex::benchmark::run_threads(threadCount, [&](std::size_t thread)
+            {
+                std::uint64_t seed = thread * 0x9E3779B97F4A7C15 + 1;
+                std::uint64_t sum = 0;
+
+                for (std::size_t i = 0; i < operations / threadCount; ++i)
+                {
+                    std::uint64_t value = 0;
+
+                    if (i % 2 == 0)
+                    {
+                        queue.push(next_random(seed));
+                    }
+                    else if (queue.try_pop(value))
+                    {
+                        sum += value;
+                    }
+                }
+
+                sink.fetch_add(sum, std::memory_order_relaxed);
+            });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = Dataplex::benchmark::parse_options(argc, argv);
+
+    Dataplex::benchmark::print_header("Concurrent priority queue, alternating push and pop");
+
+    for (auto threadCount : Dataplex::benchmark::thread_counts(options.maxThreads))
+    {
+        double seconds = 0.0;
+
+        {
+            Dataplex::LockedPriorityQueue<std::uint64_t> queue;
+
+            seconds = churn(queue, threadCount, options.operations);
+        }
+
+        Dataplex::benchmark::print_result("LockedPriorityQueue", threadCount, options.operations, seconds);
+
+        {
+            Dataplex::MultiQueue<std::uint64_t> queue(threadCount);
+
+            seconds = churn(queue, threadCount, options.operations);
+        }
+
+        Dataplex::benchmark::print_result("MultiQueue", threadCount, options.operations, seconds);
+    }
+}
@@ -0,0 +1,210 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ReclamationBenchmark.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Benchmark.hpp"
+
+#include "Reclamation.hpp"
+#include "DynamicArray.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+    constexpr std::size_t SharedCount = 64;
+
+    struct Node
+    {
+        std::uint64_t value;
+    };
+
+    struct Shared
+    {
+        Shared()
+        {
+            for (auto& slot : slots)
+            {
+                slot.store(new Node{ 0 });
+            }
+        }
+
+        ~Shared()
+        {
+            for (auto& slot : slots)
+            {
+                delete slot.load();
+            }
+        }
+
+        std::atomic<Node*> slots[SharedCount];
+    };
+
+    class LeakingWorker
+    {
+    public:
+        std::uint64_t read(std::atomic<Node*>& slot)
+        {
+            return slot.load(std::memory_order_acquire)->value;
+        }
+
+        void replace(std::atomic<Node*>& slot, Node* node)
+        {
+            _retired.push_back(slot.exchange(node, std::memory_order_acq_rel));
+        }
+
+        void finish()
+        {
+            for (auto node : _retired)
+            {
+                delete node;
+            }
+        }
+
+    private:
+        Dataplex::DynamicArray<Node*> _retired;
+    };
+
+    class EpochWorker
+    {
+    public:
+        explicit EpochWorker(Dataplex::EpochManager& manager) :
+            _manager(manager)
+        {
+        }
+
+        std::uint64_t read(std::atomic<Node*>& slot)
+        {
+            Dataplex::EpochGuard guard(_manager);
+
+            return slot.load(std::memory_order_acquire)->value;
+        }
+
+        void replace(std::atomic<Node*>& slot, Node* node)
+        {
+            Dataplex::EpochGuard guard(_manager);
+
+            _manager.retire(slot.exchange(node, std::memory_order_acq_rel));
+        }
+
+        void finish()
+        {
+        }
+
+    private:
+        Dataplex::EpochManager& _manager;
+    };
+
+    class HazardWorker
+    {
+    public:
+        explicit HazardWorker(Dataplex::HazardPointerDomain& domain) :
+            _domain(domain),
+            _hazard(domain)
+        {
+        }
+
+        std::uint64_t read(std::atomic<Node*>& slot)
+        {
+            auto value = _hazard.protect(slot)->value;
+
+            _hazard.reset();
+
+            return value;
+        }
+
+        void replace(std::atomic<Node*>& slot, Node* node)
+        {
+            _domain.retire(slot.exchange(node, std::memory_order_acq_rel));
+        }
+
+        void finish()
+        {
+        }
+
+    private:
+        Dataplex::HazardPointerDomain& _domain;
+        Dataplex::HazardPointer _hazard;
+    };
+
+    std::uint64_t next_random(std::uint64_t& seed)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        return seed;
+    }
+
+    template<typename MakeWorker>
+    double churn(std::size_t threadCount, std::size_t operations, MakeWorker makeWorker)
+    {
+        Shared shared;
+        std::atomic<std::uint64_t> sink(0);
+
+        return Dataplex::benchmark::run_threads(threadCount, [&](std::size_t thread)
+            {
+                auto worker = makeWorker();
+
+                std::uint64_t seed = thread * 0x9E3779B97F4A7C15 + 1;
+                std::uint64_t sum = 0;
+
+                for (std::size_t i = 0; i < operations / threadCount; ++i)
+                {
+                    auto random = next_random(seed);
+                    auto& slot = shared.slots[random % SharedCount];
+
+                    if (random % 8 == 0)
+                    {
+                        worker->replace(slot, new Node{ random });
+                    }
+                    else
+                    {
+                        sum += worker->read(slot);
+                    }
+                }
+
+                worker->finish();
+                sink.fetch_add(sum, std::memory_order_relaxed);
+            });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = Dataplex::benchmark::parse_options(argc, argv);
+
+    Dataplex::benchmark::print_header("Reclamation overhead under churn, 1 in 8 operations retires a node");
+
+    for (auto threadCount : Dataplex::benchmark::thread_counts(options.maxThreads))
+    {
+        auto seconds = churn(threadCount, options.operations,
+            []() { return std::make_unique<LeakingWorker>(); });
+
+        Dataplex::benchmark::print_result("no reclamation", threadCount, options.operations, seconds);
+
+        {
+            Dataplex::EpochManager manager;
+
+            seconds = churn(threadCount, options.operations,
+                [&manager]() { return std::make_unique<EpochWorker>(manager); });
+        }
+
+        Dataplex::benchmark::print_result("EpochManager", threadCount, options.operations, seconds);
+
+        {
+            Dataplex::HazardPointerDomain domain;
+
+            seconds = churn(threadCount, options.operations,
+                [&domain]() { return std::make_unique<HazardWorker>(domain); });
+        }
+
+        Dataplex::benchmark::print_result("HazardPointerDomain", threadCount, options.operations, seconds);
+    }
+}
@@ -0,0 +1,94 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - WorkStealingDequeBenchmark.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Benchmark.hpp"
+
+#include "WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+    template<typename T, typename MakeTask>
+    double steal(std::size_t threadCount, std::size_t operations, std::size_t popInterval, MakeTask makeTask)
+    {
+        Dataplex::WorkStealingDeque<T> deque;
+        std::atomic<bool> done(false);
+        std::atomic<std::size_t> sink(0);
+
+        return Dataplex::benchmark::run_threads(threadCount, [&](std::size_t thread)
+            {
+                T task;
+                std::size_t taken = 0;
+
+                if (thread == 0)
+                {
+                    for (std::size_t i = 0; i < operations; ++i)
+                    {
+                        deque.push(makeTask(i));
+
+                        if ((threadCount == 1 || i % popInterval == 0) && deque.try_pop(task))
+                        {
+                            ++taken;
+                        }
+                    }
+
+                    while (deque.try_pop(task))
+                    {
+                        ++taken;
+                    }
+
+                    done.store(true, std::memory_order_release);
+                }
+                else
+                {
+                    while (true)
+                    {
+                        if (deque.try_steal(task))
+                        {
+                            ++taken;
+                        }
+                        else if (done.load(std::memory_order_acquire))
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                sink.fetch_add(taken, std::memory_order_relaxed);
+            });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = Dataplex::benchmark::parse_options(argc, argv);
+
+    Dataplex::benchmark::print_header("Work-stealing deque, one owner pushing and the other threads stealing");
+
+    for (auto threadCount : Dataplex::benchmark::thread_counts(options.maxThreads))
+    {
+        auto seconds = steal<std::uint64_t>(threadCount, options.operations, options.operations,
+            [](std::size_t i) { return static_cast<std::uint64_t>(i); });
+
+        Dataplex::benchmark::print_result("steal only", threadCount, options.operations, seconds);
+
+        seconds = steal<std::uint64_t>(threadCount, options.operations, 2,
+            [](std::size_t i) { return static_cast<std::uint64_t>(i); });
+
+        Dataplex::benchmark::print_result("owner pops every 2nd push", threadCount, options.operations, seconds);
+
+        seconds = steal<std::unique_ptr<std::uint64_t>>(threadCount, options.operations, options.operations,
+            [](std::size_t i) { return std::make_unique<std::uint64_t>(i); });
+
+        Dataplex::benchmark::print_result("steal only, boxed tasks", threadCount, options.operations, seconds);
+    }
+}
@@ -0,0 +1,1297 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - BTreeMap.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        template<typename Key, typename Compare>
+        constexpr bool is_branchless_searchable();
+
+        template<typename Key, typename Compare>
+        std::size_t count_less(const Key* keys, std::size_t count, const Key& key, const Compare& comp);
+
+        template<typename Key, typename Compare>
+        std::size_t count_less_equal(const Key* keys, std::size_t count, const Key& key, const Compare& comp);
+
+        template<typename Key>
+        std::size_t count_greater_simd(const Key* keys, std::size_t count, const Key& key, std::size_t& processed);
+    }
+
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class BTreeMap
+    {
+    public:
+        BTreeMap();
+        explicit BTreeMap(const Compare& comp);
+        BTreeMap(const BTreeMap<Key, Value, Compare>& map);
+        BTreeMap<Key, Value, Compare>& operator=(const BTreeMap<Key, Value, Compare>& map);
+        BTreeMap(BTreeMap<Key, Value, Compare>&& map);
+        BTreeMap<Key, Value, Compare>& operator=(BTreeMap<Key, Value, Compare>&& map);
+        BTreeMap(std::initializer_list<std::pair<Key, Value>> list);
+
+        ~BTreeMap();
+
+        class Iterator;
+        class ConstIterator;
+
+        template<typename It>
+        class Range;
+
+        Iterator begin();
+        ConstIterator begin() const;
+
+        Iterator end();
+        ConstIterator end() const;
+
+        Value& operator[](const Key& key);
+
+        Value& at(const Key& key);
+        const Value& at(const Key& key) const;
+
+        Iterator find(const Key& key);
+        ConstIterator find(const Key& key) const;
+
+        bool contains(const Key& key) const;
+
+        Iterator lower_bound(const Key& key);
+        ConstIterator lower_bound(const Key& key) const;
+
+        Iterator upper_bound(const Key& key);
+        ConstIterator upper_bound(const Key& key) const;
+
+        Range<Iterator> range(const Key& low, const Key& high);
+        Range<ConstIterator> range(const Key& low, const Key& high) const;
+
+        bool insert(const Key& key, const Value& value);
+        bool insert(const Key& key, Value&& value);
+        bool erase(const Key& key);
+
+        void bulk_load(const DynamicArray<Key>& keys, const DynamicArray<Value>& values);
+        void clear();
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t NodeBytes = 256;
+        static constexpr std::size_t LeafCapacity = std::max<std::size_t>(NodeBytes / sizeof(Key), 8);
+        static constexpr std::size_t InternalCapacity = std::max<std::size_t>(NodeBytes / sizeof(Key), 8);
+        static constexpr std::size_t LeafMinimum = LeafCapacity / 2;
+        static constexpr std::size_t InternalMinimum = (InternalCapacity - 1) / 2;
+
+        struct Node
+        {
+            std::size_t count = 0;
+            bool leaf;
+
+            explicit Node(bool leaf);
+        };
+
+        struct alignas(64) Leaf : Node
+        {
+            Leaf();
+
+            Key keys[LeafCapacity];
+            Value values[LeafCapacity];
+            Leaf* previous;
+            Leaf* next;
+        };
+
+        struct alignas(64) Internal : Node
+        {
+            Internal();
+
+            Key keys[InternalCapacity];
+            Node* children[InternalCapacity + 1];
+        };
+
+        Node* _root;
+        Leaf* _first;
+        Leaf* _last;
+        std::size_t _size;
+        Compare _comp;
+
+        std::pair<Leaf*, std::size_t> insert_entry(const Key& key, bool& inserted);
+        std::pair<Leaf*, std::size_t> find_leaf(const Key& key, bool upper) const;
+
+        bool is_full(const Node* node) const;
+        void split_child(Internal* parent, std::size_t index);
+
+        bool erase_from(Node* node, const Key& key);
+        void rebalance(Internal* parent, std::size_t index);
+        void borrow_from_left(Internal* parent, std::size_t index);
+        void borrow_from_right(Internal* parent, std::size_t index);
+        void merge_children(Internal* parent, std::size_t index);
+
+        Node* clone(const Node* node, Leaf*& previous);
+        void destroy(Node* node);
+
+        void swap(BTreeMap<Key, Value, Compare>& map);
+
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = std::pair<const Key&, Value&>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::pair<const Key&, Value&>;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator();
+            Iterator(Leaf* leaf, std::size_t index);
+
+            std::pair<const Key&, Value&> operator*() const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            bool operator==(const Iterator& iterator) const;
+            bool operator!=(const Iterator& iterator) const;
+
+        private:
+            Leaf* _leaf;
+            std::size_t _index;
+        };
+
+        class ConstIterator
+        {
+        public:
+            using value_type = std::pair<const Key&, const Value&>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::pair<const Key&, const Value&>;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(const Leaf* leaf, std::size_t index);
+
+            std::pair<const Key&, const Value&> operator*() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const Leaf* _leaf;
+            std::size_t _index;
+        };
+
+        template<typename It>
+        class Range
+        {
+        public:
+            Range(It first, It last);
+
+            It begin() const;
+            It end() const;
+
+        private:
+            It _first;
+            It _last;
+        };
+    };
+}
+
+template<typename Key, typename Compare>
+constexpr bool Dataplex::detail::is_branchless_searchable()
+{
+    return std::is_arithmetic<Key>::value &&
+        (std::is_same<Compare, std::less<Key>>::value || std::is_same<Compare, std::less<>>::value);
+}
+
+template<typename Key>
+std::size_t Dataplex::detail::count_greater_simd(const Key* keys, std::size_t count, const Key& key, std::size_t& processed)
+{
+    std::size_t result = 0;
+    processed = 0;
+
+#if defined(__AVX2__)
+    if constexpr (std::is_integral<Key>::value && (sizeof(Key) == 8 || sizeof(Key) == 4))
+    {
+        using Signed = std::make_signed_t<Key>;
+
+        constexpr auto Lanes = 32 / sizeof(Key);
+        constexpr auto Bias = std::is_signed<Key>::value ? Signed(0) : std::numeric_limits<Signed>::min();
+
+        auto target = static_cast<Signed>(static_cast<Signed>(key) ^ Bias);
+        auto needle = sizeof(Key) == 8 ? _mm256_set1_epi64x(static_cast<long long>(target)) : _mm256_set1_epi32(static_cast<int>(target));
+        auto bias = sizeof(Key) == 8 ? _mm256_set1_epi64x(static_cast<long long>(Bias)) : _mm256_set1_epi32(static_cast<int>(Bias));
+
+        for (; processed + Lanes <= count; processed += Lanes)
+        {
+            auto block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + processed)), bias);
+
+            if constexpr (sizeof(Key) == 8)
+            {
+                result += static_cast<std::size_t>(__builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(block, needle)))));
+            }
+            else
+            {
+                result += static_cast<std::size_t>(__builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(block, needle)))));
+            }
+        }
+    }
+#else
+    (void)keys;
+    (void)count;
+    (void)key;
+#endif
+
+    return result;
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::detail::count_less(const Key* keys, std::size_t count, const Key& key, const Compare& comp)
+{
+    if constexpr (is_branchless_searchable<Key, Compare>())
+    {
+        std::size_t processed = 0;
+        std::size_t result = 0;
+
+        if constexpr (std::is_integral<Key>::value)
+        {
+            if (key != std::numeric_limits<Key>::min())
+            {
+                auto greater = count_greater_simd(keys, count, static_cast<Key>(key - 1), processed);
+                result = processed - greater;
+            }
+        }
+
+        for (auto i = processed; i < count; ++i)
+        {
+            result += keys[i] < key;
+        }
+
+        return result;
+    }
+    else
+    {
+        return static_cast<std::size_t>(std::lower_bound(keys, keys + count, key, comp) - keys);
+    }
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::detail::count_less_equal(const Key* keys, std::size_t count, const Key& key, const Compare& comp)
+{
+    if constexpr (is_branchless_searchable<Key, Compare>())
+    {
+        std::size_t processed = 0;
+        std::size_t result = 0;
+
+        if constexpr (std::is_integral<Key>::value)
+        {
+            auto greater = count_greater_simd(keys, count, key, processed);
+            result = processed - greater;
+        }
+
+        for (auto i = processed; i < count; ++i)
+        {
+            result += !(key < keys[i]);
+        }
+
+        return result;
+    }
+    else
+    {
+        return static_cast<std::size_t>(std::upper_bound(keys, keys + count, key, comp) - keys);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::BTreeMap() :
+    BTreeMap(Compare())
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::BTreeMap(const Compare& comp) :
+    _root(nullptr),
+    _first(nullptr),
+    _last(nullptr),
+    _size(0),
+    _comp(comp)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::BTreeMap(const BTreeMap<Key, Value, Compare>& map) :
+    BTreeMap(map._comp)
+{
+    if (map._root)
+    {
+        Leaf* previous = nullptr;
+
+        _root = clone(map._root, previous);
+        _last = previous;
+        _size = map._size;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>& Dataplex::BTreeMap<Key, Value, Compare>::operator=(const BTreeMap<Key, Value, Compare>& map)
+{
+    BTreeMap<Key, Value, Compare> temp(map);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::BTreeMap(BTreeMap<Key, Value, Compare>&& map) :
+    BTreeMap(map._comp)
+{
+    swap(map);
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>& Dataplex::BTreeMap<Key, Value, Compare>::operator=(BTreeMap<Key, Value, Compare>&& map)
+{
+    swap(map);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::BTreeMap(std::initializer_list<std::pair<Key, Value>> list) :
+    BTreeMap()
+{
+    for (const auto& entry : list)
+    {
+        insert(entry.first, entry.second);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::~BTreeMap()
+{
+    clear();
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::begin()
+{
+    return Iterator(_first, 0);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::begin() const
+{
+    return ConstIterator(_first, 0);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::end()
+{
+    return Iterator();
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::end() const
+{
+    return ConstIterator();
+}
+
+template<typename Key, typename Value, typename Compare>
+Value& Dataplex::BTreeMap<Key, Value, Compare>::operator[](const Key& key)
+{
+    bool inserted;
+    auto entry = insert_entry(key, inserted);
+
+    return entry.first->values[entry.second];
+}
+
+template<typename Key, typename Value, typename Compare>
+Value& Dataplex::BTreeMap<Key, Value, Compare>::at(const Key& key)
+{
+    auto iterator = find(key);
+
+    if (iterator == end())
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return (*iterator).second;
+}
+
+template<typename Key, typename Value, typename Compare>
+const Value& Dataplex::BTreeMap<Key, Value, Compare>::at(const Key& key) const
+{
+    auto iterator = find(key);
+
+    if (iterator == end())
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return (*iterator).second;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::find(const Key& key)
+{
+    auto iterator = lower_bound(key);
+
+    if (iterator == end() || _comp(key, (*iterator).first))
+    {
+        return end();
+    }
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::find(const Key& key) const
+{
+    auto iterator = lower_bound(key);
+
+    if (iterator == end() || _comp(key, (*iterator).first))
+    {
+        return end();
+    }
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::contains(const Key& key) const
+{
+    return find(key) != end();
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::lower_bound(const Key& key)
+{
+    auto position = find_leaf(key, false);
+
+    return Iterator(position.first, position.second);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::lower_bound(const Key& key) const
+{
+    auto position = find_leaf(key, false);
+
+    return ConstIterator(position.first, position.second);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::upper_bound(const Key& key)
+{
+    auto position = find_leaf(key, true);
+
+    return Iterator(position.first, position.second);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::upper_bound(const Key& key) const
+{
+    auto position = find_leaf(key, true);
+
+    return ConstIterator(position.first, position.second);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::template Range<typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator>
+Dataplex::BTreeMap<Key, Value, Compare>::range(const Key& low, const Key& high)
+{
+    if (!_comp(low, high))
+    {
+        return Range<Iterator>(end(), end());
+    }
+
+    return Range<Iterator>(lower_bound(low), lower_bound(high));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::template Range<typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator>
+Dataplex::BTreeMap<Key, Value, Compare>::range(const Key& low, const Key& high) const
+{
+    if (!_comp(low, high))
+    {
+        return Range<ConstIterator>(end(), end());
+    }
+
+    return Range<ConstIterator>(lower_bound(low), lower_bound(high));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::insert(const Key& key, const Value& value)
+{
+    bool inserted;
+    auto entry = insert_entry(key, inserted);
+
+    if (inserted)
+    {
+        entry.first->values[entry.second] = value;
+    }
+
+    return inserted;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::insert(const Key& key, Value&& value)
+{
+    bool inserted;
+    auto entry = insert_entry(key, inserted);
+
+    if (inserted)
+    {
+        entry.first->values[entry.second] = std::move(value);
+    }
+
+    return inserted;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::erase(const Key& key)
+{
+    if (!_root || !erase_from(_root, key))
+    {
+        return false;
+    }
+
+    --_size;
+
+    if (!_root->leaf && _root->count == 0)
+    {
+        auto root = static_cast<Internal*>(_root);
+
+        _root = root->children[0];
+        delete root;
+    }
+    else if (_root->leaf && _root->count == 0)
+    {
+        delete static_cast<Leaf*>(_root);
+
+        _root = nullptr;
+        _first = nullptr;
+        _last = nullptr;
+    }
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::bulk_load(const DynamicArray<Key>& keys, const DynamicArray<Value>& values)
+{
+    if (keys.size() != values.size())
+    {
+        throw std::invalid_argument("Bulk load needs one value per key!");
+    }
+
+    for (std::size_t i = 1; i < keys.size(); ++i)
+    {
+        if (!_comp(keys[i - 1], keys[i]))
+        {
+            throw std::invalid_argument("Bulk load keys must be sorted and unique!");
+        }
+    }
+
+    clear();
+
+    if (keys.is_empty())
+    {
+        return;
+    }
+
+    auto leafCount = (keys.size() + LeafCapacity - 1) / LeafCapacity;
+
+    DynamicArray<Node*> level(leafCount);
+    DynamicArray<Key> minimums(leafCount);
+    std::size_t pos = 0;
+
+    for (std::size_t i = 0; i < leafCount; ++i)
+    {
+        auto leaf = new Leaf();
+        auto count = keys.size() / leafCount + (i < keys.size() % leafCount ? 1 : 0);
+
+        for (std::size_t j = 0; j < count; ++j, ++pos)
+        {
+            leaf->keys[j] = keys[pos];
+            leaf->values[j] = values[pos];
+        }
+
+        leaf->count = count;
+        leaf->previous = _last;
+
+        if (_last)
+        {
+            _last->next = leaf;
+        }
+        else
+        {
+            _first = leaf;
+        }
+
+        _last = leaf;
+
+        level.push_back(leaf);
+        minimums.push_back(leaf->keys[0]);
+    }
+
+    while (level.size() > 1)
+    {
+        auto parentCount = (level.size() + InternalCapacity) / (InternalCapacity + 1);
+
+        DynamicArray<Node*> parents(parentCount);
+        DynamicArray<Key> parentMinimums(parentCount);
+        std::size_t child = 0;
+
+        for (std::size_t i = 0; i < parentCount; ++i)
+        {
+            auto parent = new Internal();
+            auto count = level.size() / parentCount + (i < level.size() % parentCount ? 1 : 0);
+
+            parentMinimums.push_back(minimums[child]);
+            parent->children[0] = level[child++];
+
+            for (std::size_t j = 1; j < count; ++j, ++child)
+            {
+                parent->keys[j - 1] = minimums[child];
+                parent->children[j] = level[child];
+            }
+
+            parent->count = count - 1;
+            parents.push_back(parent);
+        }
+
+        level = std::move(parents);
+        minimums = std::move(parentMinimums);
+    }
+
+    _root = level[0];
+    _size = keys.size();
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::clear()
+{
+    if (_root)
+    {
+        destroy(_root);
+    }
+
+    _root = nullptr;
+    _first = nullptr;
+    _last = nullptr;
+    _size = 0;
+}
+
+template<typename Key, typename Value, typename Compare>
+std::size_t Dataplex::BTreeMap<Key, Value, Compare>::size() const
+{
+    return _size;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::Node::Node(bool leaf) :
+    leaf(leaf)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::Leaf::Leaf() :
+    Node(true),
+    keys(),
+    values(),
+    previous(nullptr),
+    next(nullptr)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::Internal::Internal() :
+    Node(false),
+    keys(),
+    children()
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<typename Dataplex::BTreeMap<Key, Value, Compare>::Leaf*, std::size_t>
+Dataplex::BTreeMap<Key, Value, Compare>::insert_entry(const Key& key, bool& inserted)
+{
+    if (!_root)
+    {
+        _first = _last = new Leaf();
+        _root = _first;
+    }
+
+    if (is_full(_root))
+    {
+        auto root = new Internal();
+
+        root->children[0] = _root;
+        _root = root;
+
+        split_child(root, 0);
+    }
+
+    auto node = _root;
+
+    while (!node->leaf)
+    {
+        auto internal = static_cast<Internal*>(node);
+        auto index = detail::count_less_equal(internal->keys, internal->count, key, _comp);
+
+        if (is_full(internal->children[index]))
+        {
+            split_child(internal, index);
+
+            if (!_comp(key, internal->keys[index]))
+            {
+                ++index;
+            }
+        }
+
+        node = internal->children[index];
+    }
+
+    auto leaf = static_cast<Leaf*>(node);
+    auto pos = detail::count_less(leaf->keys, leaf->count, key, _comp);
+
+    if (pos < leaf->count && !_comp(key, leaf->keys[pos]))
+    {
+        inserted = false;
+
+        return { leaf, pos };
+    }
+
+    std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+    std::move_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+
+    leaf->keys[pos] = key;
+    leaf->values[pos] = Value();
+
+    ++leaf->count;
+    ++_size;
+
+    inserted = true;
+
+    return { leaf, pos };
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<typename Dataplex::BTreeMap<Key, Value, Compare>::Leaf*, std::size_t>
+Dataplex::BTreeMap<Key, Value, Compare>::find_leaf(const Key& key, bool upper) const
+{
+    if (!_root)
+    {
+        return { nullptr, 0 };
+    }
+
+    auto node = _root;
+
+    while (!node->leaf)
+    {
+        auto internal = static_cast<const Internal*>(node);
+
+        node = internal->children[detail::count_less_equal(internal->keys, internal->count, key, _comp)];
+    }
+
+    auto leaf = static_cast<Leaf*>(node);
+    auto pos = upper ? detail::count_less_equal(leaf->keys, leaf->count, key, _comp) :
+        detail::count_less(leaf->keys, leaf->count, key, _comp);
+
+    if (pos == leaf->count)
+    {
+        return { leaf->next, 0 };
+    }
+
+    return { leaf, pos };
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::is_full(const Node* node) const
+{
+    return node->count == (node->leaf ? LeafCapacity : InternalCapacity);
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::split_child(Internal* parent, std::size_t index)
+{
+    auto child = parent->children[index];
+    Node* sibling;
+    Key separator;
+
+    if (child->leaf)
+    {
+        auto left = static_cast<Leaf*>(child);
+        auto right = new Leaf();
+        auto middle = left->count / 2;
+
+        std::move(left->keys + middle, left->keys + left->count, right->keys);
+        std::move(left->values + middle, left->values + left->count, right->values);
+
+        right->count = left->count - middle;
+        left->count = middle;
+
+        right->previous = left;
+        right->next = left->next;
+
+        if (right->next)
+        {
+            right->next->previous = right;
+        }
+        else
+        {
+            _last = right;
+        }
+
+        left->next = right;
+
+        separator = right->keys[0];
+        sibling = right;
+    }
+    else
+    {
+        auto left = static_cast<Internal*>(child);
+        auto right = new Internal();
+        auto middle = left->count / 2;
+
+        separator = std::move(left->keys[middle]);
+
+        std::move(left->keys + middle + 1, left->keys + left->count, right->keys);
+        std::copy(left->children + middle + 1, left->children + left->count + 1, right->children);
+
+        right->count = left->count - middle - 1;
+        left->count = middle;
+
+        sibling = right;
+    }
+
+    std::move_backward(parent->keys + index, parent->keys + parent->count, parent->keys + parent->count + 1);
+    std::copy_backward(parent->children + index + 1, parent->children + parent->count + 1, parent->children + parent->count + 2);
+
+    parent->keys[index] = std::move(separator);
+    parent->children[index + 1] = sibling;
+
+    ++parent->count;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::erase_from(Node* node, const Key& key)
+{
+    if (node->leaf)
+    {
+        auto leaf = static_cast<Leaf*>(node);
+        auto pos = detail::count_less(leaf->keys, leaf->count, key, _comp);
+
+        if (pos == leaf->count || _comp(key, leaf->keys[pos]))
+        {
+            return false;
+        }
+
+        std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+        std::move(leaf->values + pos + 1, leaf->values + leaf->count, leaf->values + pos);
+
+        --leaf->count;
+
+        leaf->keys[leaf->count] = Key();
+        leaf->values[leaf->count] = Value();
+
+        return true;
+    }
+
+    auto internal = static_cast<Internal*>(node);
+    auto index = detail::count_less_equal(internal->keys, internal->count, key, _comp);
+
+    if (!erase_from(internal->children[index], key))
+    {
+        return false;
+    }
+
+    auto child = internal->children[index];
+
+    if (child->count < (child->leaf ? LeafMinimum : InternalMinimum))
+    {
+        rebalance(internal, index);
+    }
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::rebalance(Internal* parent, std::size_t index)
+{
+    auto minimum = parent->children[index]->leaf ? LeafMinimum : InternalMinimum;
+
+    if (index > 0 && parent->children[index - 1]->count > minimum)
+    {
+        borrow_from_left(parent, index);
+    }
+    else if (index < parent->count && parent->children[index + 1]->count > minimum)
+    {
+        borrow_from_right(parent, index);
+    }
+    else if (index > 0)
+    {
+        merge_children(parent, index - 1);
+    }
+    else
+    {
+        merge_children(parent, index);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::borrow_from_left(Internal* parent, std::size_t index)
+{
+    if (parent->children[index]->leaf)
+    {
+        auto left = static_cast<Leaf*>(parent->children[index - 1]);
+        auto child = static_cast<Leaf*>(parent->children[index]);
+
+        std::move_backward(child->keys, child->keys + child->count, child->keys + child->count + 1);
+        std::move_backward(child->values, child->values + child->count, child->values + child->count + 1);
+
+        child->keys[0] = std::move(left->keys[left->count - 1]);
+        child->values[0] = std::move(left->values[left->count - 1]);
+
+        --left->count;
+        ++child->count;
+
+        parent->keys[index - 1] = child->keys[0];
+    }
+    else
+    {
+        auto left = static_cast<Internal*>(parent->children[index - 1]);
+        auto child = static_cast<Internal*>(parent->children[index]);
+
+        std::move_backward(child->keys, child->keys + child->count, child->keys + child->count + 1);
+        std::copy_backward(child->children, child->children + child->count + 1, child->children + child->count + 2);
+
+        child->keys[0] = std::move(parent->keys[index - 1]);
+        child->children[0] = left->children[left->count];
+        parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+
+        --left->count;
+        ++child->count;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::borrow_from_right(Internal* parent, std::size_t index)
+{
+    if (parent->children[index]->leaf)
+    {
+        auto child = static_cast<Leaf*>(parent->children[index]);
+        auto right = static_cast<Leaf*>(parent->children[index + 1]);
+
+        child->keys[child->count] = std::move(right->keys[0]);
+        child->values[child->count] = std::move(right->values[0]);
+
+        std::move(right->keys + 1, right->keys + right->count, right->keys);
+        std::move(right->values + 1, right->values + right->count, right->values);
+
+        ++child->count;
+        --right->count;
+
+        parent->keys[index] = right->keys[0];
+    }
+    else
+    {
+        auto child = static_cast<Internal*>(parent->children[index]);
+        auto right = static_cast<Internal*>(parent->children[index + 1]);
+
+        child->keys[child->count] = std::move(parent->keys[index]);
+        child->children[child->count + 1] = right->children[0];
+        parent->keys[index] = std::move(right->keys[0]);
+
+        std::move(right->keys + 1, right->keys + right->count, right->keys);
+        std::copy(right->children + 1, right->children + right->count + 1, right->children);
+
+        ++child->count;
+        --right->count;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::merge_children(Internal* parent, std::size_t index)
+{
+    if (parent->children[index]->leaf)
+    {
+        auto left = static_cast<Leaf*>(parent->children[index]);
+        auto right = static_cast<Leaf*>(parent->children[index + 1]);
+
+        std::move(right->keys, right->keys + right->count, left->keys + left->count);
+        std::move(right->values, right->values + right->count, left->values + left->count);
+
+        left->count += right->count;
+        left->next = right->next;
+
+        if (left->next)
+        {
+            left->next->previous = left;
+        }
+        else
+        {
+            _last = left;
+        }
+
+        delete right;
+    }
+    else
+    {
+        auto left = static_cast<Internal*>(parent->children[index]);
+        auto right = static_cast<Internal*>(parent->children[index + 1]);
+
+        left->keys[left->count] = std::move(parent->keys[index]);
+
+        std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+        std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+
+        left->count += right->count + 1;
+
+        delete right;
+    }
+
+    std::move(parent->keys + index + 1, parent->keys + parent->count, parent->keys + index);
+    std::copy(parent->children + index + 2, parent->children + parent->count + 1, parent->children + index + 1);
+
+    --parent->count;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Node* Dataplex::BTreeMap<Key, Value, Compare>::clone(const Node* node, Leaf*& previous)
+{
+    if (node->leaf)
+    {
+        auto leaf = new Leaf(*static_cast<const Leaf*>(node));
+
+        leaf->previous = previous;
+        leaf->next = nullptr;
+
+        if (previous)
+        {
+            previous->next = leaf;
+        }
+        else
+        {
+            _first = leaf;
+        }
+
+        previous = leaf;
+
+        return leaf;
+    }
+
+    auto source = static_cast<const Internal*>(node);
+    auto internal = new Internal();
+
+    try
+    {
+        std::copy(source->keys, source->keys + source->count, internal->keys);
+        internal->count = source->count;
+
+        for (std::size_t i = 0; i <= source->count; ++i)
+        {
+            internal->children[i] = clone(source->children[i], previous);
+        }
+    }
+    catch (...)
+    {
+        destroy(internal);
+
+        throw;
+    }
+
+    return internal;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::destroy(Node* node)
+{
+    if (node->leaf)
+    {
+        delete static_cast<Leaf*>(node);
+
+        return;
+    }
+
+    auto internal = static_cast<Internal*>(node);
+
+    for (std::size_t i = 0; i <= internal->count; ++i)
+    {
+        if (internal->children[i])
+        {
+            destroy(internal->children[i]);
+        }
+    }
+
+    delete internal;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::BTreeMap<Key, Value, Compare>::swap(BTreeMap<Key, Value, Compare>& map)
+{
+    using std::swap;
+
+    swap(_root, map._root);
+    swap(_first, map._first);
+    swap(_last, map._last);
+    swap(_size, map._size);
+    swap(_comp, map._comp);
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::Iterator::Iterator() :
+    _leaf(nullptr),
+    _index(0)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::Iterator::Iterator(Leaf* leaf, std::size_t index) :
+    _leaf(leaf),
+    _index(index)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<const Key&, Value&> Dataplex::BTreeMap<Key, Value, Compare>::Iterator::operator*() const
+{
+    return { _leaf->keys[_index], _leaf->values[_index] };
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator& Dataplex::BTreeMap<Key, Value, Compare>::Iterator::operator++()
+{
+    if (++_index == _leaf->count)
+    {
+        _leaf = _leaf->next;
+        _index = 0;
+    }
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::Iterator Dataplex::BTreeMap<Key, Value, Compare>::Iterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::Iterator::operator==(const Iterator& iterator) const
+{
+    return _leaf == iterator._leaf && _index == iterator._index;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::Iterator::operator!=(const Iterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::ConstIterator() :
+    _leaf(nullptr),
+    _index(0)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::ConstIterator(const Leaf* leaf, std::size_t index) :
+    _leaf(leaf),
+    _index(index)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<const Key&, const Value&> Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::operator*() const
+{
+    return { _leaf->keys[_index], _leaf->values[_index] };
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator& Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::operator++()
+{
+    if (++_index == _leaf->count)
+    {
+        _leaf = _leaf->next;
+        _index = 0;
+    }
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _leaf == iterator._leaf && _index == iterator._index;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::BTreeMap<Key, Value, Compare>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename It>
+Dataplex::BTreeMap<Key, Value, Compare>::Range<It>::Range(It first, It last) :
+    _first(first),
+    _last(last)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename It>
+It Dataplex::BTreeMap<Key, Value, Compare>::Range<It>::begin() const
+{
+    return _first;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename It>
+It Dataplex::BTreeMap<Key, Value, Compare>::Range<It>::end() const
+{
+    return _last;
+}
@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - BTreeSet.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Utility.hpp"
+#include "BTreeMap.hpp"
+#include "DynamicArray.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Compare = std::less<Key>>
+    class BTreeSet
+    {
+    public:
+        BTreeSet();
+        explicit BTreeSet(const Compare& comp);
+        BTreeSet(std::initializer_list<Key> list);
+
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        ConstIterator find(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        ConstIterator lower_bound(const Key& key) const;
+        ConstIterator upper_bound(const Key& key) const;
+
+        typename BTreeMap<Key, detail::EmptyValue, Compare>::template Range<ConstIterator>
+        range(const Key& low, const Key& high) const;
+
+        bool insert(const Key& key);
+        bool erase(const Key& key);
+
+        void bulk_load(const DynamicArray<Key>& keys);
+        void clear();
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        using Map = BTreeMap<Key, detail::EmptyValue, Compare>;
+
+        Map _map;
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = Key;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Key*;
+            using reference = const Key&;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            explicit ConstIterator(typename Map::ConstIterator iterator);
+
+            const Key& operator*() const;
+            const Key* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            typename Map::ConstIterator _iterator;
+        };
+    };
+}
+
+template<typename Key, typename Compare>
+Dataplex::BTreeSet<Key, Compare>::BTreeSet() :
+    _map()
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::BTreeSet<Key, Compare>::BTreeSet(const Compare& comp) :
+    _map(comp)
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::BTreeSet<Key, Compare>::BTreeSet(std::initializer_list<Key> list) :
+    BTreeSet()
+{
+    for (const auto& key : list)
+    {
+        insert(key);
+    }
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::begin() const
+{
+    return ConstIterator(_map.begin());
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::end() const
+{
+    return ConstIterator(_map.end());
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::find(const Key& key) const
+{
+    return ConstIterator(_map.find(key));
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::contains(const Key& key) const
+{
+    return _map.contains(key);
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::lower_bound(const Key& key) const
+{
+    return ConstIterator(_map.lower_bound(key));
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::upper_bound(const Key& key) const
+{
+    return ConstIterator(_map.upper_bound(key));
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeMap<Key, Dataplex::detail::EmptyValue, Compare>::template Range<typename Dataplex::BTreeSet<Key, Compare>::ConstIterator>
+Dataplex::BTreeSet<Key, Compare>::range(const Key& low, const Key& high) const
+{
+    auto range = _map.range(low, high);
+
+    return { ConstIterator(range.begin()), ConstIterator(range.end()) };
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::insert(const Key& key)
+{
+    return _map.insert(key, detail::EmptyValue());
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::erase(const Key& key)
+{
+    return _map.erase(key);
+}
+
+template<typename Key, typename Compare>
+void Dataplex::BTreeSet<Key, Compare>::bulk_load(const DynamicArray<Key>& keys)
+{
+    DynamicArray<detail::EmptyValue> values;
+    values.resize(keys.size());
+
+    _map.bulk_load(keys, values);
+}
+
+template<typename Key, typename Compare>
+void Dataplex::BTreeSet<Key, Compare>::clear()
+{
+    _map.clear();
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::BTreeSet<Key, Compare>::size() const
+{
+    return _map.size();
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::is_empty() const
+{
+    return _map.is_empty();
+}
+
+template<typename Key, typename Compare>
+Dataplex::BTreeSet<Key, Compare>::ConstIterator::ConstIterator() :
+    _iterator()
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::BTreeSet<Key, Compare>::ConstIterator::ConstIterator(typename Map::ConstIterator iterator) :
+    _iterator(iterator)
+{
+}
+
+template<typename Key, typename Compare>
+const Key& Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator*() const
+{
+    return (*_iterator).first;
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator->() const
+{
+    return &(*_iterator).first;
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator& Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator++()
+{
+    ++_iterator;
+
+    return *this;
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::BTreeSet<Key, Compare>::ConstIterator Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _iterator == iterator._iterator;
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::BTreeSet<Key, Compare>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _iterator != iterator._iterator;
+}
@@ -0,0 +1,219 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - BitOperations.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        enum class BitOperation
+        {
+            And,
+            Or,
+            Xor,
+            AndNot
+        };
+
+        constexpr std::size_t WordBits = 64;
+
+        constexpr std::size_t word_count(std::size_t bits);
+        constexpr std::uint64_t tail_mask(std::size_t bits);
+
+        int popcount(std::uint64_t word);
+        int count_trailing_zeros(std::uint64_t word);
+        int count_leading_zeros(std::uint64_t word);
+        std::size_t select_in_word(std::uint64_t word, std::size_t rank);
+
+        template<BitOperation Operation>
+        std::uint64_t combine(std::uint64_t left, std::uint64_t right);
+
+        template<BitOperation Operation>
+        void combine_words(std::uint64_t* words, const std::uint64_t* other, std::size_t count);
+
+        std::size_t popcount_words(const std::uint64_t* words, std::size_t count);
+        std::size_t find_next_word_bit(const std::uint64_t* words, std::size_t count, std::size_t pos);
+    }
+}
+
+constexpr std::size_t Dataplex::detail::word_count(std::size_t bits)
+{
+    return (bits + WordBits - 1) / WordBits;
+}
+
+constexpr std::uint64_t Dataplex::detail::tail_mask(std::size_t bits)
+{
+    return bits % WordBits == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << (bits % WordBits)) - 1;
+}
+
+inline int Dataplex::detail::popcount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555);
+    word = (word & 0x3333333333333333) + ((word >> 2) & 0x3333333333333333);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0F;
+
+    return static_cast<int>((word * 0x0101010101010101) >> 56);
+#endif
+}
+
+inline int Dataplex::detail::count_trailing_zeros(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int count = 0;
+
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
+
+inline int Dataplex::detail::count_leading_zeros(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(word);
+#else
+    int count = 0;
+
+    while ((word & (std::uint64_t(1) << 63)) == 0)
+    {
+        word <<= 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
+
+inline std::size_t Dataplex::detail::select_in_word(std::uint64_t word, std::size_t rank)
+{
+#if defined(__BMI2__)
+    return static_cast<std::size_t>(count_trailing_zeros(_pdep_u64(std::uint64_t(1) << rank, word)));
+#else
+    for (; rank > 0; --rank)
+    {
+        word &= word - 1;
+    }
+
+    return static_cast<std::size_t>(count_trailing_zeros(word));
+#endif
+}
+
+template<Dataplex::detail::BitOperation Operation>
+std::uint64_t Dataplex::detail::combine(std::uint64_t left, std::uint64_t right)
+{
+    if constexpr (Operation == BitOperation::And)
+    {
+        return left & right;
+    }
+    else if constexpr (Operation == BitOperation::Or)
+    {
+        return left | right;
+    }
+    else if constexpr (Operation == BitOperation::Xor)
+    {
+        return left ^ right;
+    }
+    else
+    {
+        return left & ~right;
+    }
+}
+
+template<Dataplex::detail::BitOperation Operation>
+void Dataplex::detail::combine_words(std::uint64_t* words, const std::uint64_t* other, std::size_t count)
+{
+#if defined(__AVX2__)
+    auto vectorCount = count / 4;
+
+    for (std::size_t i = 0; i < vectorCount * 4; i += 4)
+    {
+        auto left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        auto right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other + i));
+
+        if constexpr (Operation == BitOperation::And)
+        {
+            left = _mm256_and_si256(left, right);
+        }
+        else if constexpr (Operation == BitOperation::Or)
+        {
+            left = _mm256_or_si256(left, right);
+        }
+        else if constexpr (Operation == BitOperation::Xor)
+        {
+            left = _mm256_xor_si256(left, right);
+        }
+        else
+        {
+            left = _mm256_andnot_si256(right, left);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i), left);
+    }
+
+    words += vectorCount * 4;
+    other += vectorCount * 4;
+    count -= vectorCount * 4;
+#endif
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        words[i] = combine<Operation>(words[i], other[i]);
+    }
+}
+
+inline std::size_t Dataplex::detail::popcount_words(const std::uint64_t* words, std::size_t count)
+{
+    std::size_t total = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        total += static_cast<std::size_t>(popcount(words[i]));
+    }
+
+    return total;
+}
+
+inline std::size_t Dataplex::detail::find_next_word_bit(const std::uint64_t* words, std::size_t count, std::size_t pos)
+{
+    auto index = pos / WordBits;
+
+    if (index >= count)
+    {
+        return count * WordBits;
+    }
+
+    auto word = words[index] & (~std::uint64_t(0) << (pos % WordBits));
+
+    while (word == 0)
+    {
+        if (++index == count)
+        {
+            return count * WordBits;
+        }
+
+        word = words[index];
+    }
+
+    return index * WordBits + static_cast<std::size_t>(count_trailing_zeros(word));
+}
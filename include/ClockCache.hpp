@@ -0,0 +1,476 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ClockCache.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Hash.hpp"
+#include "HashMap.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Value, typename Hasher = hash::Hash<Key>>
+    class ClockCache
+    {
+    public:
+        using Weigher = std::function<std::size_t(const Key&, const Value&)>;
+        using EvictionCallback = std::function<void(const Key&, Value&)>;
+
+        explicit ClockCache(std::size_t capacity, Weigher weigher = Weigher(), const Hasher& hasher = Hasher());
+        ClockCache(const ClockCache<Key, Value, Hasher>& cache);
+        ClockCache<Key, Value, Hasher>& operator=(const ClockCache<Key, Value, Hasher>& cache);
+        ClockCache(ClockCache<Key, Value, Hasher>&& cache);
+        ClockCache<Key, Value, Hasher>& operator=(ClockCache<Key, Value, Hasher>&& cache);
+
+        Value* get(const Key& key);
+        const Value* peek(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        bool put(const Key& key, const Value& value);
+        bool put(Key&& key, Value&& value);
+        bool erase(const Key& key);
+
+        void set_eviction_callback(EvictionCallback callback);
+        void resize(std::size_t capacity);
+        void clear();
+
+        std::size_t size() const;
+        std::size_t weight() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+
+        std::size_t hits() const;
+        std::size_t misses() const;
+        std::size_t evictions() const;
+        void reset_statistics();
+
+    private:
+        struct Entry
+        {
+            template<typename K, typename V>
+            Entry(K&& key, V&& value, std::size_t weight);
+
+            Key key;
+            Value value;
+            std::size_t weight;
+            bool referenced;
+        };
+
+        using List = DoublyLinkedList<Entry>;
+        using Position = typename List::Iterator;
+
+        List _ring;
+        HashMap<Key, Position, Hasher> _map;
+        Hasher _hasher;
+        Position _hand;
+
+        Weigher _weigher;
+        EvictionCallback _callback;
+
+        std::size_t _capacity;
+        std::size_t _weight;
+
+        std::size_t _hits;
+        std::size_t _misses;
+        std::size_t _evictions;
+
+        template<typename K, typename V>
+        bool insert(K&& key, V&& value);
+
+        std::size_t weigh(const Key& key, const Value& value) const;
+        Position advance(Position position);
+        Position sweep();
+        void evict();
+        void swap(ClockCache<Key, Value, Hasher>& cache);
+    };
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::ClockCache<Key, Value, Hasher>::ClockCache(std::size_t capacity, Weigher weigher, const Hasher& hasher) :
+    _ring(),
+    _map(HashMap<Key, Position, Hasher>::Resize::Immediate, hasher),
+    _hasher(hasher),
+    _hand(nullptr),
+    _weigher(std::move(weigher)),
+    _callback(),
+    _capacity(capacity),
+    _weight(0),
+    _hits(0),
+    _misses(0),
+    _evictions(0)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Cache capacity must be greater than zero!");
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::ClockCache<Key, Value, Hasher>::ClockCache(const ClockCache<Key, Value, Hasher>& cache) :
+    ClockCache(cache._capacity, cache._weigher, cache._hasher)
+{
+    _callback = cache._callback;
+
+    auto hand = cache._hand;
+
+    for (auto entry = cache._ring.begin(); entry != cache._ring.end(); ++entry)
+    {
+        auto position = _ring.emplace(_ring.end(), entry->key, entry->value, entry->weight);
+        position->referenced = entry->referenced;
+
+        _map.emplace(entry->key, position);
+
+        if (hand != Position(nullptr) && hand->key == entry->key)
+        {
+            _hand = position;
+        }
+
+        _weight += entry->weight;
+    }
+
+    _hits = cache._hits;
+    _misses = cache._misses;
+    _evictions = cache._evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::ClockCache<Key, Value, Hasher>& Dataplex::ClockCache<Key, Value, Hasher>::operator=(const ClockCache<Key, Value, Hasher>& cache)
+{
+    ClockCache<Key, Value, Hasher> temp(cache);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::ClockCache<Key, Value, Hasher>::ClockCache(ClockCache<Key, Value, Hasher>&& cache) :
+    ClockCache(cache._capacity, Weigher(), cache._hasher)
+{
+    swap(cache);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::ClockCache<Key, Value, Hasher>& Dataplex::ClockCache<Key, Value, Hasher>::operator=(ClockCache<Key, Value, Hasher>&& cache)
+{
+    swap(cache);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value* Dataplex::ClockCache<Key, Value, Hasher>::get(const Key& key)
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        ++_misses;
+
+        return nullptr;
+    }
+
+    ++_hits;
+
+    found->second->referenced = true;
+
+    return &found->second->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+const Value* Dataplex::ClockCache<Key, Value, Hasher>::peek(const Key& key) const
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return nullptr;
+    }
+
+    auto position = found->second;
+
+    return &position->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::ClockCache<Key, Value, Hasher>::contains(const Key& key) const
+{
+    return _map.contains(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::ClockCache<Key, Value, Hasher>::put(const Key& key, const Value& value)
+{
+    return insert(key, value);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::ClockCache<Key, Value, Hasher>::put(Key&& key, Value&& value)
+{
+    return insert(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::ClockCache<Key, Value, Hasher>::erase(const Key& key)
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return false;
+    }
+
+    auto position = found->second;
+
+    _weight -= position->weight;
+
+    if (position == _hand)
+    {
+        _hand = advance(_hand);
+    }
+
+    _map.erase(key);
+    _ring.erase(position);
+
+    if (_ring.is_empty())
+    {
+        _hand = Position(nullptr);
+    }
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::set_eviction_callback(EvictionCallback callback)
+{
+    _callback = std::move(callback);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::resize(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Cache capacity must be greater than zero!");
+    }
+
+    _capacity = capacity;
+
+    evict();
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::clear()
+{
+    _ring.clear();
+    _map.clear();
+
+    _hand = Position(nullptr);
+    _weight = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::size() const
+{
+    return _ring.size();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::weight() const
+{
+    return _weight;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::ClockCache<Key, Value, Hasher>::is_empty() const
+{
+    return _ring.is_empty();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::hits() const
+{
+    return _hits;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::misses() const
+{
+    return _misses;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::evictions() const
+{
+    return _evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::reset_statistics()
+{
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+Dataplex::ClockCache<Key, Value, Hasher>::Entry::Entry(K&& key, V&& value, std::size_t weight) :
+    key(std::forward<K>(key)),
+    value(std::forward<V>(value)),
+    weight(weight),
+    referenced(false)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+bool Dataplex::ClockCache<Key, Value, Hasher>::insert(K&& key, V&& value)
+{
+    auto weight = weigh(key, value);
+
+    if (weight > _capacity)
+    {
+        erase(key);
+
+        return false;
+    }
+
+    auto found = _map.find(key);
+
+    if (found != _map.end())
+    {
+        auto position = found->second;
+
+        _weight = _weight - position->weight + weight;
+
+        position->value = std::forward<V>(value);
+        position->weight = weight;
+        position->referenced = true;
+    }
+    else if (!_weigher && _ring.size() == _capacity)
+    {
+        auto position = sweep();
+
+        if (_callback)
+        {
+            _callback(position->key, position->value);
+        }
+
+        _map.erase(position->key);
+
+        position->key = key;
+        position->value = std::forward<V>(value);
+        position->referenced = false;
+
+        _map.emplace(std::forward<K>(key), position);
+        _hand = advance(position);
+
+        ++_evictions;
+
+        return true;
+    }
+    else
+    {
+        auto position = _ring.emplace(_hand, key, std::forward<V>(value), weight);
+
+        _map.emplace(std::forward<K>(key), position);
+
+        if (_hand == Position(nullptr))
+        {
+            _hand = position;
+        }
+
+        _weight += weight;
+    }
+
+    evict();
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::ClockCache<Key, Value, Hasher>::weigh(const Key& key, const Value& value) const
+{
+    return _weigher ? _weigher(key, value) : 1;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::ClockCache<Key, Value, Hasher>::Position Dataplex::ClockCache<Key, Value, Hasher>::advance(Position position)
+{
+    ++position;
+
+    return position == _ring.end() ? _ring.begin() : position;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::ClockCache<Key, Value, Hasher>::Position Dataplex::ClockCache<Key, Value, Hasher>::sweep()
+{
+    while (_hand->referenced)
+    {
+        _hand->referenced = false;
+        _hand = advance(_hand);
+    }
+
+    return _hand;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::evict()
+{
+    while (_weight > _capacity && !_ring.is_empty())
+    {
+        auto position = sweep();
+
+        if (_callback)
+        {
+            _callback(position->key, position->value);
+        }
+
+        _weight -= position->weight;
+        _hand = advance(position);
+
+        _map.erase(position->key);
+        _ring.erase(position);
+
+        if (_ring.is_empty())
+        {
+            _hand = Position(nullptr);
+        }
+
+        ++_evictions;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::ClockCache<Key, Value, Hasher>::swap(ClockCache<Key, Value, Hasher>& cache)
+{
+    using std::swap;
+
+    swap(_ring, cache._ring);
+    swap(_map, cache._map);
+    swap(_hasher, cache._hasher);
+    swap(_hand, cache._hand);
+    swap(_weigher, cache._weigher);
+    swap(_callback, cache._callback);
+    swap(_capacity, cache._capacity);
+    swap(_weight, cache._weight);
+    swap(_hits, cache._hits);
+    swap(_misses, cache._misses);
+    swap(_evictions, cache._evictions);
+}
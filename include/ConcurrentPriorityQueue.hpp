@@ -0,0 +1,298 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentPriorityQueue.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "PriorityQueue.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename T, typename Comp = std::less<T>>
+    class LockedPriorityQueue
+    {
+    public:
+        LockedPriorityQueue();
+        LockedPriorityQueue(const LockedPriorityQueue<T, Comp>& queue) = delete;
+        LockedPriorityQueue<T, Comp>& operator=(const LockedPriorityQueue<T, Comp>& queue) = delete;
+
+        void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
+        bool try_pop(T& data);
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        mutable std::mutex _mutex;
+        PriorityQueue<T, Comp> _queue;
+    };
+
+    // The element count is updated under the lock of the shard that holds the element, so size()
+    // never counts an element that no shard holds. Emptiness is still relaxed: try_pop can return
+    // false while concurrent pushes land in shards it has already swept.
+    template<typename T, typename Comp = std::less<T>>
+    class MultiQueue
+    {
+    public:
+        explicit MultiQueue(std::size_t threadCount = std::thread::hardware_concurrency(), std::size_t queuesPerThread = 2);
+        MultiQueue(const MultiQueue<T, Comp>& queue) = delete;
+        MultiQueue<T, Comp>& operator=(const MultiQueue<T, Comp>& queue) = delete;
+
+        void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
+        bool try_pop(T& data);
+
+        std::size_t queue_count() const;
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t PopAttempts = 8;
+
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            PriorityQueue<T, Comp> queue;
+        };
+
+        std::unique_ptr<Shard[]> _shards;
+        std::size_t _count;
+        std::atomic<std::size_t> _size;
+        Comp _comp;
+
+        Shard& random_shard();
+        bool sweep(T& data);
+
+        static std::uint64_t next_random();
+    };
+}
+
+template<typename T, typename Comp>
+Dataplex::LockedPriorityQueue<T, Comp>::LockedPriorityQueue() :
+    _mutex(),
+    _queue()
+{
+}
+
+template<typename T, typename Comp>
+void Dataplex::LockedPriorityQueue<T, Comp>::push(const T& data)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push(data);
+}
+
+template<typename T, typename Comp>
+void Dataplex::LockedPriorityQueue<T, Comp>::push(T&& data)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push(std::move(data));
+}
+
+template<typename T, typename Comp>
+template<typename... Args>
+void Dataplex::LockedPriorityQueue<T, Comp>::emplace(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push(std::move(data));
+}
+
+template<typename T, typename Comp>
+bool Dataplex::LockedPriorityQueue<T, Comp>::try_pop(T& data)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _queue.try_pop(data);
+}
+
+template<typename T, typename Comp>
+std::size_t Dataplex::LockedPriorityQueue<T, Comp>::size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _queue.size();
+}
+
+template<typename T, typename Comp>
+bool Dataplex::LockedPriorityQueue<T, Comp>::is_empty() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _queue.is_empty();
+}
+
+template<typename T, typename Comp>
+Dataplex::MultiQueue<T, Comp>::MultiQueue(std::size_t threadCount, std::size_t queuesPerThread) :
+    _shards(),
+    _count(std::max<std::size_t>(threadCount, 1) * std::max<std::size_t>(queuesPerThread, 2)),
+    _size(0),
+    _comp()
+{
+    _shards.reset(new Shard[_count]);
+}
+
+template<typename T, typename Comp>
+void Dataplex::MultiQueue<T, Comp>::push(const T& data)
+{
+    emplace(data);
+}
+
+template<typename T, typename Comp>
+void Dataplex::MultiQueue<T, Comp>::push(T&& data)
+{
+    emplace(std::move(data));
+}
+
+template<typename T, typename Comp>
+template<typename... Args>
+void Dataplex::MultiQueue<T, Comp>::emplace(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);
+
+    while (true)
+    {
+        auto& shard = random_shard();
+
+        if (shard.mutex.try_lock())
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex, std::adopt_lock);
+            shard.queue.push(std::move(data));
+
+            _size.fetch_add(1, std::memory_order_release);
+
+            break;
+        }
+    }
+}
+
+template<typename T, typename Comp>
+bool Dataplex::MultiQueue<T, Comp>::try_pop(T& data)
+{
+    for (std::size_t attempt = 0; attempt < PopAttempts; ++attempt)
+    {
+        if (_size.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        auto first = &random_shard();
+        auto second = &random_shard();
+
+        if (first == second)
+        {
+            continue;
+        }
+
+        if (!first->mutex.try_lock())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> firstLock(first->mutex, std::adopt_lock);
+
+        if (!second->mutex.try_lock())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> secondLock(second->mutex, std::adopt_lock);
+
+        auto best = first;
+
+        if (best->queue.is_empty() || (!second->queue.is_empty() && _comp(best->queue.front(), second->queue.front())))
+        {
+            best = second;
+        }
+
+        if (best->queue.try_pop(data))
+        {
+            _size.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+
+    return sweep(data);
+}
+
+template<typename T, typename Comp>
+std::size_t Dataplex::MultiQueue<T, Comp>::queue_count() const
+{
+    return _count;
+}
+
+template<typename T, typename Comp>
+std::size_t Dataplex::MultiQueue<T, Comp>::size() const
+{
+    return _size.load(std::memory_order_relaxed);
+}
+
+template<typename T, typename Comp>
+bool Dataplex::MultiQueue<T, Comp>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename T, typename Comp>
+typename Dataplex::MultiQueue<T, Comp>::Shard& Dataplex::MultiQueue<T, Comp>::random_shard()
+{
+    return _shards[next_random() % _count];
+}
+
+template<typename T, typename Comp>
+bool Dataplex::MultiQueue<T, Comp>::sweep(T& data)
+{
+    auto start = static_cast<std::size_t>(next_random() % _count);
+
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+        auto& shard = _shards[(start + i) % _count];
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        if (shard.queue.try_pop(data))
+        {
+            _size.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<typename T, typename Comp>
+std::uint64_t Dataplex::MultiQueue<T, Comp>::next_random()
+{
+    static thread_local std::uint64_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return seed;
+}
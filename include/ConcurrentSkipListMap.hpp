@@ -0,0 +1,599 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentSkipListMap.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Reclamation.hpp"
+#include "BitOperations.hpp"
+
+#include <new>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class ConcurrentSkipListMap
+    {
+    public:
+        ConcurrentSkipListMap();
+        explicit ConcurrentSkipListMap(const Compare& comp);
+        ConcurrentSkipListMap(const ConcurrentSkipListMap<Key, Value, Compare>& map) = delete;
+        ConcurrentSkipListMap<Key, Value, Compare>& operator=(const ConcurrentSkipListMap<Key, Value, Compare>& map) = delete;
+
+        ~ConcurrentSkipListMap();
+
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        ConstIterator find(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        ConstIterator lower_bound(const Key& key) const;
+        ConstIterator upper_bound(const Key& key) const;
+
+        bool insert(const Key& key, const Value& value);
+        bool insert(Key&& key, Value&& value);
+        bool erase(const Key& key);
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t MaxHeight = 32;
+
+        using Link = std::atomic<std::uintptr_t>;
+
+        struct Node
+        {
+            template<typename K, typename V>
+            Node(K&& key, V&& value, std::size_t height);
+
+            Link* next;
+            std::size_t height;
+            std::atomic<std::size_t> links;
+            const Key key;
+            Value value;
+        };
+
+        Link _head[MaxHeight];
+        std::atomic<std::size_t> _height;
+        std::atomic<std::size_t> _size;
+        Compare _comp;
+
+        template<typename K, typename V>
+        bool emplace_node(K&& key, V&& value);
+
+        void link_levels(Node* node, const Link** preds, Node** succs);
+        bool find_position(const Key& key, const Link** preds, Node** succs);
+        const Node* search(const Key& key, bool inclusive) const;
+        void release(Node* node);
+
+        static std::size_t random_height();
+
+        template<typename K, typename V>
+        static Node* create_node(K&& key, V&& value, std::size_t height);
+        static void destroy_node(void* node);
+
+        static Node* to_node(std::uintptr_t link);
+        static bool is_marked(std::uintptr_t link);
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = std::pair<const Key&, const Value&>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::pair<const Key&, const Value&>;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            explicit ConstIterator(const Node* node);
+
+            std::pair<const Key&, const Value&> operator*() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            EpochGuard _guard;
+            const Node* _node;
+        };
+    };
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConcurrentSkipListMap() :
+    ConcurrentSkipListMap(Compare())
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConcurrentSkipListMap(const Compare& comp) :
+    _height(1),
+    _size(0),
+    _comp(comp)
+{
+    for (auto& link : _head)
+    {
+        link.store(0, std::memory_order_relaxed);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::~ConcurrentSkipListMap()
+{
+    for (auto level = MaxHeight; level-- > 0;)
+    {
+        auto node = to_node(_head[level].load());
+
+        while (node)
+        {
+            auto next = to_node(node->next[level].load());
+
+            if (node->links.fetch_sub(1) == 1)
+            {
+                destroy_node(node);
+            }
+
+            node = next;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::begin() const
+{
+    EpochGuard guard;
+
+    auto node = to_node(_head[0].load(std::memory_order_acquire));
+
+    while (node && is_marked(node->next[0].load(std::memory_order_acquire)))
+    {
+        node = to_node(node->next[0].load(std::memory_order_acquire));
+    }
+
+    return ConstIterator(node);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::end() const
+{
+    return ConstIterator(nullptr);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::find(const Key& key) const
+{
+    EpochGuard guard;
+
+    auto node = search(key, true);
+
+    return ConstIterator(node && !_comp(key, node->key) ? node : nullptr);
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::contains(const Key& key) const
+{
+    EpochGuard guard;
+
+    auto node = search(key, true);
+
+    return node && !_comp(key, node->key);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::lower_bound(const Key& key) const
+{
+    EpochGuard guard;
+
+    return ConstIterator(search(key, true));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::upper_bound(const Key& key) const
+{
+    EpochGuard guard;
+
+    return ConstIterator(search(key, false));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::insert(const Key& key, const Value& value)
+{
+    return emplace_node(key, value);
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::insert(Key&& key, Value&& value)
+{
+    return emplace_node(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::erase(const Key& key)
+{
+    EpochGuard guard;
+
+    const Link* preds[MaxHeight];
+    Node* succs[MaxHeight];
+
+    if (!find_position(key, preds, succs))
+    {
+        return false;
+    }
+
+    auto node = succs[0];
+
+    for (auto level = node->height; level-- > 1;)
+    {
+        auto link = node->next[level].load(std::memory_order_acquire);
+
+        while (!is_marked(link) && !node->next[level].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel))
+        {
+        }
+    }
+
+    auto link = node->next[0].load(std::memory_order_acquire);
+
+    do
+    {
+        if (is_marked(link))
+        {
+            return false;
+        }
+    } while (!node->next[0].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel));
+
+    _size.fetch_sub(1, std::memory_order_relaxed);
+
+    find_position(key, preds, succs);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+std::size_t Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::size() const
+{
+    return _size.load(std::memory_order_relaxed);
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename K, typename V>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::Node::Node(K&& key, V&& value, std::size_t height) :
+    next(reinterpret_cast<Link*>(this + 1)),
+    height(height),
+    links(2),
+    key(std::forward<K>(key)),
+    value(std::forward<V>(value))
+{
+    for (std::size_t level = 0; level < height; ++level)
+    {
+        new (next + level) Link(0);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename K, typename V>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::emplace_node(K&& key, V&& value)
+{
+    EpochGuard guard;
+
+    const Link* preds[MaxHeight];
+    Node* succs[MaxHeight];
+
+    auto node = create_node(std::forward<K>(key), std::forward<V>(value), random_height());
+
+    while (true)
+    {
+        if (find_position(node->key, preds, succs))
+        {
+            destroy_node(node);
+
+            return false;
+        }
+
+        for (std::size_t level = 0; level < node->height; ++level)
+        {
+            node->next[level].store(reinterpret_cast<std::uintptr_t>(succs[level]), std::memory_order_relaxed);
+        }
+
+        auto expected = reinterpret_cast<std::uintptr_t>(succs[0]);
+
+        if (const_cast<Link*>(preds[0])->compare_exchange_strong(expected, reinterpret_cast<std::uintptr_t>(node),
+            std::memory_order_acq_rel))
+        {
+            break;
+        }
+    }
+
+    _size.fetch_add(1, std::memory_order_relaxed);
+
+    auto height = _height.load(std::memory_order_relaxed);
+
+    while (height < node->height && !_height.compare_exchange_weak(height, node->height, std::memory_order_relaxed))
+    {
+    }
+
+    link_levels(node, preds, succs);
+
+    if (is_marked(node->next[0].load(std::memory_order_acquire)))
+    {
+        find_position(node->key, preds, succs);
+    }
+
+    release(node);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::link_levels(Node* node, const Link** preds, Node** succs)
+{
+    for (std::size_t level = 1; level < node->height; ++level)
+    {
+        while (true)
+        {
+            auto link = node->next[level].load(std::memory_order_acquire);
+            auto succ = reinterpret_cast<std::uintptr_t>(succs[level]);
+
+            if (is_marked(link))
+            {
+                return;
+            }
+
+            if (link != succ && !node->next[level].compare_exchange_strong(link, succ, std::memory_order_acq_rel))
+            {
+                continue;
+            }
+
+            node->links.fetch_add(1, std::memory_order_relaxed);
+
+            if (const_cast<Link*>(preds[level])->compare_exchange_strong(succ, reinterpret_cast<std::uintptr_t>(node),
+                std::memory_order_acq_rel))
+            {
+                break;
+            }
+
+            node->links.fetch_sub(1, std::memory_order_relaxed);
+
+            find_position(node->key, preds, succs);
+
+            if (succs[0] != node)
+            {
+                return;
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::find_position(const Key& key, const Link** preds, Node** succs)
+{
+    auto height = _height.load(std::memory_order_relaxed);
+    bool restart;
+
+    do
+    {
+        restart = false;
+
+        const Link* tower = _head;
+        Node* node = nullptr;
+
+        for (auto level = height; level-- > 0 && !restart;)
+        {
+            node = to_node(tower[level].load(std::memory_order_acquire));
+
+            while (node)
+            {
+                auto link = node->next[level].load(std::memory_order_acquire);
+
+                if (is_marked(link))
+                {
+                    auto expected = reinterpret_cast<std::uintptr_t>(node);
+
+                    if (!const_cast<Link*>(tower + level)->compare_exchange_strong(expected, link & ~std::uintptr_t(1),
+                        std::memory_order_acq_rel))
+                    {
+                        restart = true;
+
+                        break;
+                    }
+
+                    release(node);
+                    node = to_node(link);
+                }
+                else if (_comp(node->key, key))
+                {
+                    tower = node->next;
+                    node = to_node(link);
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            preds[level] = tower + level;
+            succs[level] = node;
+        }
+    } while (restart);
+
+    for (auto level = height; level < MaxHeight; ++level)
+    {
+        preds[level] = _head + level;
+        succs[level] = nullptr;
+    }
+
+    return succs[0] && !_comp(key, succs[0]->key);
+}
+
+template<typename Key, typename Value, typename Compare>
+const typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::Node*
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::search(const Key& key, bool inclusive) const
+{
+    const Link* tower = _head;
+    const Node* node = nullptr;
+
+    for (auto level = _height.load(std::memory_order_relaxed); level-- > 0;)
+    {
+        node = to_node(tower[level].load(std::memory_order_acquire));
+
+        while (node)
+        {
+            auto link = node->next[level].load(std::memory_order_acquire);
+
+            if (is_marked(link))
+            {
+                node = to_node(link);
+            }
+            else if (inclusive ? _comp(node->key, key) : !_comp(key, node->key))
+            {
+                tower = node->next;
+                node = to_node(link);
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    return node;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::release(Node* node)
+{
+    if (node->links.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        EpochManager::global().retire(node, &destroy_node);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+std::size_t Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::random_height()
+{
+    static thread_local std::uint64_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return 1 + static_cast<std::size_t>(detail::count_trailing_zeros(seed | (std::uint64_t(1) << 62))) / 2;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename K, typename V>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::Node*
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::create_node(K&& key, V&& value, std::size_t height)
+{
+    auto memory = ::operator new(sizeof(Node) + height * sizeof(Link));
+
+    try
+    {
+        return new (memory) Node(std::forward<K>(key), std::forward<V>(value), height);
+    }
+    catch (...)
+    {
+        ::operator delete(memory);
+
+        throw;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::destroy_node(void* node)
+{
+    static_cast<Node*>(node)->~Node();
+
+    ::operator delete(node);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::Node*
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::to_node(std::uintptr_t link)
+{
+    return reinterpret_cast<Node*>(link & ~std::uintptr_t(1));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::is_marked(std::uintptr_t link)
+{
+    return (link & 1) != 0;
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::ConstIterator() :
+    _guard(),
+    _node(nullptr)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::ConstIterator(const Node* node) :
+    _guard(),
+    _node(node)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<const Key&, const Value&> Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::operator*() const
+{
+    return { _node->key, _node->value };
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator&
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::operator++()
+{
+    do
+    {
+        _node = to_node(_node->next[0].load(std::memory_order_acquire));
+    } while (_node && is_marked(_node->next[0].load(std::memory_order_acquire)));
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator
+Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _node == iterator._node;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::ConcurrentSkipListMap<Key, Value, Compare>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _node != iterator._node;
+}
@@ -0,0 +1,208 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentSkipListSet.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Utility.hpp"
+#include "ConcurrentSkipListMap.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Compare = std::less<Key>>
+    class ConcurrentSkipListSet
+    {
+    public:
+        ConcurrentSkipListSet();
+        explicit ConcurrentSkipListSet(const Compare& comp);
+
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        ConstIterator find(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        ConstIterator lower_bound(const Key& key) const;
+        ConstIterator upper_bound(const Key& key) const;
+
+        bool insert(const Key& key);
+        bool insert(Key&& key);
+        bool erase(const Key& key);
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        using Map = ConcurrentSkipListMap<Key, detail::EmptyValue, Compare>;
+
+        Map _map;
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = Key;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Key*;
+            using reference = const Key&;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            explicit ConstIterator(typename Map::ConstIterator iterator);
+
+            const Key& operator*() const;
+            const Key* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            typename Map::ConstIterator _iterator;
+        };
+    };
+}
+
+template<typename Key, typename Compare>
+Dataplex::ConcurrentSkipListSet<Key, Compare>::ConcurrentSkipListSet() :
+    _map()
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::ConcurrentSkipListSet<Key, Compare>::ConcurrentSkipListSet(const Compare& comp) :
+    _map(comp)
+{
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::begin() const
+{
+    return ConstIterator(_map.begin());
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::end() const
+{
+    return ConstIterator(_map.end());
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::find(const Key& key) const
+{
+    return ConstIterator(_map.find(key));
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::contains(const Key& key) const
+{
+    return _map.contains(key);
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::lower_bound(const Key& key) const
+{
+    return ConstIterator(_map.lower_bound(key));
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::upper_bound(const Key& key) const
+{
+    return ConstIterator(_map.upper_bound(key));
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::insert(const Key& key)
+{
+    return _map.insert(key, detail::EmptyValue());
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::insert(Key&& key)
+{
+    return _map.insert(std::move(key), detail::EmptyValue());
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::erase(const Key& key)
+{
+    return _map.erase(key);
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::ConcurrentSkipListSet<Key, Compare>::size() const
+{
+    return _map.size();
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::is_empty() const
+{
+    return _map.is_empty();
+}
+
+template<typename Key, typename Compare>
+Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::ConstIterator() :
+    _iterator()
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::ConstIterator(typename Map::ConstIterator iterator) :
+    _iterator(iterator)
+{
+}
+
+template<typename Key, typename Compare>
+const Key& Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator*() const
+{
+    return (*_iterator).first;
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator->() const
+{
+    return &(*_iterator).first;
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator& Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator++()
+{
+    ++_iterator;
+
+    return *this;
+}
+
+template<typename Key, typename Compare>
+typename Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _iterator == iterator._iterator;
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::ConcurrentSkipListSet<Key, Compare>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _iterator != iterator._iterator;
+}
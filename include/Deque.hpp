@@ -0,0 +1,875 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Deque.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename T>
+    class Deque
+    {
+    public:
+        Deque();
+        Deque(const Deque<T>& deque);
+        Deque<T>& operator=(const Deque<T>& deque);
+        Deque(Deque<T>&& deque);
+        Deque<T>& operator=(Deque<T>&& deque);
+        Deque(std::initializer_list<T> list);
+
+        ~Deque();
+
+        class Iterator;
+        class ConstIterator;
+
+        Iterator begin();
+        ConstIterator begin() const;
+
+        Iterator end();
+        ConstIterator end() const;
+
+        std::reverse_iterator<Iterator> rbegin();
+        std::reverse_iterator<ConstIterator> rbegin() const;
+
+        std::reverse_iterator<Iterator> rend();
+        std::reverse_iterator<ConstIterator> rend() const;
+
+        T& operator[](std::size_t pos);
+        const T& operator[](std::size_t pos) const;
+
+        T& head();
+        const T& head() const;
+
+        T& tail();
+        const T& tail() const;
+
+        void push_front(const T& data);
+        void push_front(T&& data);
+        void push_back(const T& data);
+        void push_back(T&& data);
+
+        template<typename... Args>
+        void emplace_front(Args&&... args);
+        template<typename... Args>
+        void emplace_back(Args&&... args);
+
+        void pop_front();
+        void pop_back();
+
+        void clear();
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t block_size();
+
+        static constexpr std::size_t BlockSize = block_size();
+        static constexpr std::size_t InitialMapSize = 8;
+
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+            using iterator_category = std::random_access_iterator_tag;
+
+            Iterator();
+            Iterator(T** map, std::size_t index);
+
+            T& operator*() const;
+            T* operator->() const;
+            T& operator[](difference_type offset) const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            Iterator& operator--();
+            Iterator operator--(int);
+
+            Iterator& operator+=(difference_type offset);
+            Iterator& operator-=(difference_type offset);
+
+            Iterator operator+(difference_type offset) const;
+            Iterator operator-(difference_type offset) const;
+            difference_type operator-(const Iterator& iterator) const;
+
+            bool operator==(const Iterator& iterator) const;
+            bool operator!=(const Iterator& iterator) const;
+            bool operator<(const Iterator& iterator) const;
+            bool operator>(const Iterator& iterator) const;
+            bool operator<=(const Iterator& iterator) const;
+            bool operator>=(const Iterator& iterator) const;
+
+        private:
+            T** _map;
+            std::size_t _index;
+        };
+
+        class ConstIterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+            using iterator_category = std::random_access_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(T* const* map, std::size_t index);
+
+            const T& operator*() const;
+            const T* operator->() const;
+            const T& operator[](difference_type offset) const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            ConstIterator& operator--();
+            ConstIterator operator--(int);
+
+            ConstIterator& operator+=(difference_type offset);
+            ConstIterator& operator-=(difference_type offset);
+
+            ConstIterator operator+(difference_type offset) const;
+            ConstIterator operator-(difference_type offset) const;
+            difference_type operator-(const ConstIterator& iterator) const;
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+            bool operator<(const ConstIterator& iterator) const;
+            bool operator>(const ConstIterator& iterator) const;
+            bool operator<=(const ConstIterator& iterator) const;
+            bool operator>=(const ConstIterator& iterator) const;
+
+        private:
+            T* const* _map;
+            std::size_t _index;
+        };
+
+    private:
+        T** _map;
+        std::size_t _mapSize;
+        std::size_t _start;
+        std::size_t _size;
+        T* _spare;
+
+        T* element(std::size_t index) const;
+
+        T* allocate_block();
+        void release_block(T* block);
+
+        void reserve_front();
+        void reserve_back();
+        void remap(std::size_t mapSize, std::size_t firstBlock);
+
+        void swap(Deque<T>& deque);
+    };
+}
+
+template<typename T>
+Dataplex::Deque<T>::Deque() :
+    _map(new T*[InitialMapSize]()),
+    _mapSize(InitialMapSize),
+    _start(InitialMapSize / 2 * BlockSize),
+    _size(0),
+    _spare(nullptr)
+{
+}
+
+template<typename T>
+Dataplex::Deque<T>::Deque(const Deque<T>& deque) :
+    Deque()
+{
+    for (const auto& data : deque)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::Deque<T>& Dataplex::Deque<T>::operator=(const Deque<T>& deque)
+{
+    Deque<T> temp(deque);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::Deque<T>::Deque(Deque<T>&& deque) :
+    Deque()
+{
+    swap(deque);
+}
+
+template<typename T>
+Dataplex::Deque<T>& Dataplex::Deque<T>::operator=(Deque<T>&& deque)
+{
+    swap(deque);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::Deque<T>::Deque(std::initializer_list<T> list) :
+    Deque()
+{
+    for (const auto& data : list)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::Deque<T>::~Deque()
+{
+    clear();
+
+    release_block(_spare);
+    delete[] _map;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::begin()
+{
+    return Iterator(_map, _start);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::begin() const
+{
+    return ConstIterator(_map, _start);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::end()
+{
+    return Iterator(_map, _start + _size);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::end() const
+{
+    return ConstIterator(_map, _start + _size);
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::Deque<T>::Iterator> Dataplex::Deque<T>::rbegin()
+{
+    return std::make_reverse_iterator(end());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::Deque<T>::ConstIterator> Dataplex::Deque<T>::rbegin() const
+{
+    return std::make_reverse_iterator(end());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::Deque<T>::Iterator> Dataplex::Deque<T>::rend()
+{
+    return std::make_reverse_iterator(begin());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::Deque<T>::ConstIterator> Dataplex::Deque<T>::rend() const
+{
+    return std::make_reverse_iterator(begin());
+}
+
+template<typename T>
+T& Dataplex::Deque<T>::operator[](std::size_t pos)
+{
+    return *element(_start + pos);
+}
+
+template<typename T>
+const T& Dataplex::Deque<T>::operator[](std::size_t pos) const
+{
+    return *element(_start + pos);
+}
+
+template<typename T>
+T& Dataplex::Deque<T>::head()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return *element(_start);
+}
+
+template<typename T>
+const T& Dataplex::Deque<T>::head() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return *element(_start);
+}
+
+template<typename T>
+T& Dataplex::Deque<T>::tail()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return *element(_start + _size - 1);
+}
+
+template<typename T>
+const T& Dataplex::Deque<T>::tail() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return *element(_start + _size - 1);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::push_front(const T& data)
+{
+    emplace_front(data);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::push_front(T&& data)
+{
+    emplace_front(std::move(data));
+}
+
+template<typename T>
+void Dataplex::Deque<T>::push_back(const T& data)
+{
+    emplace_back(data);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::push_back(T&& data)
+{
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::Deque<T>::emplace_front(Args&&... args)
+{
+    if (_start == 0)
+    {
+        reserve_front();
+    }
+
+    auto index = _start - 1;
+    auto& block = _map[index / BlockSize];
+
+    if (!block)
+    {
+        block = allocate_block();
+    }
+
+    ::new (static_cast<void*>(block + index % BlockSize)) T(std::forward<Args>(args)...);
+
+    _start = index;
+    ++_size;
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::Deque<T>::emplace_back(Args&&... args)
+{
+    if (_start + _size == _mapSize * BlockSize)
+    {
+        reserve_back();
+    }
+
+    auto index = _start + _size;
+    auto& block = _map[index / BlockSize];
+
+    if (!block)
+    {
+        block = allocate_block();
+    }
+
+    ::new (static_cast<void*>(block + index % BlockSize)) T(std::forward<Args>(args)...);
+
+    ++_size;
+}
+
+template<typename T>
+void Dataplex::Deque<T>::pop_front()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No existing elements to remove!");
+    }
+
+    element(_start)->~T();
+
+    if (++_start % BlockSize == 0 || _size == 1)
+    {
+        auto& block = _map[(_start - 1) / BlockSize];
+
+        release_block(block);
+        block = nullptr;
+    }
+
+    if (--_size == 0)
+    {
+        _start = _mapSize / 2 * BlockSize;
+    }
+}
+
+template<typename T>
+void Dataplex::Deque<T>::pop_back()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No existing elements to remove!");
+    }
+
+    auto index = _start + _size - 1;
+    element(index)->~T();
+
+    if (index % BlockSize == 0 || _size == 1)
+    {
+        auto& block = _map[index / BlockSize];
+
+        release_block(block);
+        block = nullptr;
+    }
+
+    if (--_size == 0)
+    {
+        _start = _mapSize / 2 * BlockSize;
+    }
+}
+
+template<typename T>
+void Dataplex::Deque<T>::clear()
+{
+    while (!is_empty())
+    {
+        pop_back();
+    }
+}
+
+template<typename T>
+std::size_t Dataplex::Deque<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T>
+constexpr std::size_t Dataplex::Deque<T>::block_size()
+{
+    std::size_t size = 16;
+
+    while (size * 2 * sizeof(T) <= 4096)
+    {
+        size *= 2;
+    }
+
+    return size;
+}
+
+template<typename T>
+T* Dataplex::Deque<T>::element(std::size_t index) const
+{
+    return _map[index / BlockSize] + index % BlockSize;
+}
+
+template<typename T>
+T* Dataplex::Deque<T>::allocate_block()
+{
+    if (_spare)
+    {
+        return std::exchange(_spare, nullptr);
+    }
+
+    return std::allocator<T>().allocate(BlockSize);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::release_block(T* block)
+{
+    if (!block)
+    {
+        return;
+    }
+    else if (!_spare)
+    {
+        _spare = block;
+    }
+    else
+    {
+        std::allocator<T>().deallocate(block, BlockSize);
+    }
+}
+
+template<typename T>
+void Dataplex::Deque<T>::reserve_front()
+{
+    auto usedBlocks = (_size + BlockSize - 1) / BlockSize + 1;
+    auto mapSize = usedBlocks * 2 > _mapSize ? _mapSize * 2 : _mapSize;
+
+    remap(mapSize, (mapSize - usedBlocks) / 2 + 1);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::reserve_back()
+{
+    auto usedBlocks = (_size + BlockSize - 1) / BlockSize + 1;
+    auto mapSize = usedBlocks * 2 > _mapSize ? _mapSize * 2 : _mapSize;
+
+    remap(mapSize, (mapSize - usedBlocks) / 2);
+}
+
+template<typename T>
+void Dataplex::Deque<T>::remap(std::size_t mapSize, std::size_t firstBlock)
+{
+    auto oldFirstBlock = _start / BlockSize;
+    auto oldLastBlock = _size == 0 ? oldFirstBlock : (_start + _size - 1) / BlockSize;
+    auto blockCount = oldLastBlock - oldFirstBlock + 1;
+
+    if (mapSize == _mapSize)
+    {
+        if (firstBlock < oldFirstBlock)
+        {
+            std::move(_map + oldFirstBlock, _map + oldLastBlock + 1, _map + firstBlock);
+            std::fill(_map + std::max(firstBlock + blockCount, oldFirstBlock), _map + oldLastBlock + 1, nullptr);
+        }
+        else if (firstBlock > oldFirstBlock)
+        {
+            std::move_backward(_map + oldFirstBlock, _map + oldLastBlock + 1, _map + firstBlock + blockCount);
+            std::fill(_map + oldFirstBlock, _map + std::min(firstBlock, oldLastBlock + 1), nullptr);
+        }
+    }
+    else
+    {
+        auto map = new T*[mapSize]();
+
+        std::copy(_map + oldFirstBlock, _map + oldLastBlock + 1, map + firstBlock);
+
+        delete[] _map;
+
+        _map = map;
+        _mapSize = mapSize;
+    }
+
+    _start = firstBlock * BlockSize + _start % BlockSize;
+}
+
+template<typename T>
+void Dataplex::Deque<T>::swap(Deque<T>& deque)
+{
+    using std::swap;
+
+    swap(_map, deque._map);
+    swap(_mapSize, deque._mapSize);
+    swap(_start, deque._start);
+    swap(_size, deque._size);
+    swap(_spare, deque._spare);
+}
+
+template<typename T>
+Dataplex::Deque<T>::Iterator::Iterator() :
+    _map(nullptr),
+    _index(0)
+{
+}
+
+template<typename T>
+Dataplex::Deque<T>::Iterator::Iterator(T** map, std::size_t index) :
+    _map(map),
+    _index(index)
+{
+}
+
+template<typename T>
+T& Dataplex::Deque<T>::Iterator::operator*() const
+{
+    return _map[_index / BlockSize][_index % BlockSize];
+}
+
+template<typename T>
+T* Dataplex::Deque<T>::Iterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename T>
+T& Dataplex::Deque<T>::Iterator::operator[](difference_type offset) const
+{
+    return *(*this + offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator& Dataplex::Deque<T>::Iterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::Iterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator& Dataplex::Deque<T>::Iterator::operator--()
+{
+    --_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::Iterator::operator--(int)
+{
+    auto iterator = *this;
+    --*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator& Dataplex::Deque<T>::Iterator::operator+=(difference_type offset)
+{
+    _index += offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator& Dataplex::Deque<T>::Iterator::operator-=(difference_type offset)
+{
+    _index -= offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::Iterator::operator+(difference_type offset) const
+{
+    return Iterator(_map, _index + offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator Dataplex::Deque<T>::Iterator::operator-(difference_type offset) const
+{
+    return Iterator(_map, _index - offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::Iterator::difference_type
+Dataplex::Deque<T>::Iterator::operator-(const Iterator& iterator) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(iterator._index);
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator==(const Iterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator!=(const Iterator& iterator) const
+{
+    return _index != iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator<(const Iterator& iterator) const
+{
+    return _index < iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator>(const Iterator& iterator) const
+{
+    return _index > iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator<=(const Iterator& iterator) const
+{
+    return _index <= iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::Iterator::operator>=(const Iterator& iterator) const
+{
+    return _index >= iterator._index;
+}
+
+template<typename T>
+Dataplex::Deque<T>::ConstIterator::ConstIterator() :
+    _map(nullptr),
+    _index(0)
+{
+}
+
+template<typename T>
+Dataplex::Deque<T>::ConstIterator::ConstIterator(T* const* map, std::size_t index) :
+    _map(map),
+    _index(index)
+{
+}
+
+template<typename T>
+const T& Dataplex::Deque<T>::ConstIterator::operator*() const
+{
+    return _map[_index / BlockSize][_index % BlockSize];
+}
+
+template<typename T>
+const T* Dataplex::Deque<T>::ConstIterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename T>
+const T& Dataplex::Deque<T>::ConstIterator::operator[](difference_type offset) const
+{
+    return *(*this + offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator& Dataplex::Deque<T>::ConstIterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator& Dataplex::Deque<T>::ConstIterator::operator--()
+{
+    --_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::ConstIterator::operator--(int)
+{
+    auto iterator = *this;
+    --*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator& Dataplex::Deque<T>::ConstIterator::operator+=(difference_type offset)
+{
+    _index += offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator& Dataplex::Deque<T>::ConstIterator::operator-=(difference_type offset)
+{
+    _index -= offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::ConstIterator::operator+(difference_type offset) const
+{
+    return ConstIterator(_map, _index + offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator Dataplex::Deque<T>::ConstIterator::operator-(difference_type offset) const
+{
+    return ConstIterator(_map, _index - offset);
+}
+
+template<typename T>
+typename Dataplex::Deque<T>::ConstIterator::difference_type
+Dataplex::Deque<T>::ConstIterator::operator-(const ConstIterator& iterator) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(iterator._index);
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _index != iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator<(const ConstIterator& iterator) const
+{
+    return _index < iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator>(const ConstIterator& iterator) const
+{
+    return _index > iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator<=(const ConstIterator& iterator) const
+{
+    return _index <= iterator._index;
+}
+
+template<typename T>
+bool Dataplex::Deque<T>::ConstIterator::operator>=(const ConstIterator& iterator) const
+{
+    return _index >= iterator._index;
+}
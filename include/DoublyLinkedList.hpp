@@ -8,8 +8,11 @@ http://inversepalindrome.com
 #pragma once
 
 #include <cstddef>
+#include <utility>
 #include <iterator>
 #include <exception>
+#include <stdexcept>
+#include <initializer_list>
 
 
 namespace Dataplex
@@ -52,7 +55,14 @@ namespace Dataplex
         const T& tail() const;
 
         void push_front(const T& data);
+        void push_front(T&& data);
         void push_back(const T& data);
+        void push_back(T&& data);
+
+        template<typename... Args>
+        void emplace_front(Args&&... args);
+        template<typename... Args>
+        void emplace_back(Args&&... args);
 
         void pop_front();
         void pop_back();
@@ -60,6 +70,15 @@ namespace Dataplex
         void insert(const T& data, std::size_t pos);
         void erase(std::size_t pos);
 
+        template<typename... Args>
+        Iterator emplace(Iterator position, Args&&... args);
+        Iterator erase(Iterator position);
+
+        void move_to_front(Iterator position);
+        void move_to_back(Iterator position);
+        void splice_front(DoublyLinkedList<T>& list, Iterator position);
+        void splice_back(DoublyLinkedList<T>& list, Iterator position);
+
         void clear();
 
         std::size_t size() const;
@@ -68,22 +87,24 @@ namespace Dataplex
     private:
         struct Node
         {
-            explicit Node(const T& data);
+            template<typename... Args>
+            explicit Node(Args&&... args);
 
             T data;
             Node* next;
             Node* prev;
         };
 
+    public:
         class Iterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::bidirectional_iterator_tag;
 
-        public:
             explicit Iterator(Node* node);
 
             Iterator& operator=(Node* node);
@@ -102,17 +123,19 @@ namespace Dataplex
 
         private:
             Node* _node;
+
+            friend class DoublyLinkedList<T>;
         };
 
         class ConstIterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::bidirectional_iterator_tag;
 
-        public:
             explicit ConstIterator(Node* node);
 
             ConstIterator& operator=(Node* node);
@@ -135,13 +158,13 @@ namespace Dataplex
 
         class ReverseIterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::bidirectional_iterator_tag;
-            
-        public:
+
             explicit ReverseIterator(Node* node);
 
             ReverseIterator& operator=(Node* node);
@@ -164,13 +187,13 @@ namespace Dataplex
 
         class ConstReverseIterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::bidirectional_iterator_tag;
 
-        public:
             explicit ConstReverseIterator(Node* node);
 
             ConstReverseIterator& operator=(Node* node);
@@ -191,11 +214,16 @@ namespace Dataplex
             Node* _node;
         };
 
+    private:
         Node* _head;
         Node* _tail;
 
         std::size_t _size;
 
+        void link_front(Node* node);
+        void link_back(Node* node);
+        void unlink(Node* node);
+
         void swap(DoublyLinkedList<T>& list);
     };
 }
@@ -224,7 +252,7 @@ Dataplex::DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list)
 template<typename T>
 Dataplex::DoublyLinkedList<T>& Dataplex::DoublyLinkedList<T>::operator=(const DoublyLinkedList<T>& list)
 {
-    SinglyLinkedList<T> temp(list);
+    DoublyLinkedList<T> temp(list);
     swap(temp);
 
     return *this;
@@ -356,7 +384,20 @@ const T& Dataplex::DoublyLinkedList<T>::tail() const
 template<typename T>
 void Dataplex::DoublyLinkedList<T>::push_front(const T& data)
 {
-    auto node = new Node(data);
+    emplace_front(data);
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::push_front(T&& data)
+{
+    emplace_front(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::DoublyLinkedList<T>::emplace_front(Args&&... args)
+{
+    auto node = new Node(std::forward<Args>(args)...);
 
     if (!_head)
     {
@@ -376,7 +417,20 @@ void Dataplex::DoublyLinkedList<T>::push_front(const T& data)
 template<typename T>
 void Dataplex::DoublyLinkedList<T>::push_back(const T& data)
 {
-    auto node = new Node(data);
+    emplace_back(data);
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::push_back(T&& data)
+{
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::DoublyLinkedList<T>::emplace_back(Args&&... args)
+{
+    auto node = new Node(std::forward<Args>(args)...);
 
     if (!_head)
     {
@@ -476,8 +530,8 @@ void Dataplex::DoublyLinkedList<T>::insert(const T& data, std::size_t pos)
         Node* node = new Node(data);
         node->next = curr->next;
         node->prev = curr;
-        curr->next = node;
         curr->next->prev = node;
+        curr->next = node;
 
         ++_size;
     }
@@ -520,6 +574,95 @@ void Dataplex::DoublyLinkedList<T>::erase(std::size_t pos)
     }
 }
 
+template<typename T>
+template<typename... Args>
+typename Dataplex::DoublyLinkedList<T>::Iterator Dataplex::DoublyLinkedList<T>::emplace(Iterator position, Args&&... args)
+{
+    auto next = position._node;
+    auto node = new Node(std::forward<Args>(args)...);
+
+    if (!next)
+    {
+        link_back(node);
+    }
+    else if (next == _head)
+    {
+        link_front(node);
+    }
+    else
+    {
+        node->next = next;
+        node->prev = next->prev;
+        next->prev->next = node;
+        next->prev = node;
+
+        ++_size;
+    }
+
+    return Iterator(node);
+}
+
+template<typename T>
+typename Dataplex::DoublyLinkedList<T>::Iterator Dataplex::DoublyLinkedList<T>::erase(Iterator position)
+{
+    auto node = position._node;
+
+    if (!node)
+    {
+        throw std::out_of_range("Can't erase end iterator!");
+    }
+
+    Iterator next(node->next);
+
+    unlink(node);
+
+    delete node;
+
+    return next;
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::move_to_front(Iterator position)
+{
+    auto node = position._node;
+
+    if (node != _head)
+    {
+        unlink(node);
+        link_front(node);
+    }
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::move_to_back(Iterator position)
+{
+    auto node = position._node;
+
+    if (node != _tail)
+    {
+        unlink(node);
+        link_back(node);
+    }
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::splice_front(DoublyLinkedList<T>& list, Iterator position)
+{
+    auto node = position._node;
+
+    list.unlink(node);
+    link_front(node);
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::splice_back(DoublyLinkedList<T>& list, Iterator position)
+{
+    auto node = position._node;
+
+    list.unlink(node);
+    link_back(node);
+}
+
 template<typename T>
 void Dataplex::DoublyLinkedList<T>::clear()
 {
@@ -553,8 +696,9 @@ bool Dataplex::DoublyLinkedList<T>::is_empty() const
 }
 
 template<typename T>
-Dataplex::DoublyLinkedList<T>::Node::Node(const T& data) :
-    data(data),
+template<typename... Args>
+Dataplex::DoublyLinkedList<T>::Node::Node(Args&&... args) :
+    data(std::forward<Args>(args)...),
     next(nullptr),
     prev(nullptr)
 {
@@ -868,6 +1012,73 @@ bool Dataplex::DoublyLinkedList<T>::ConstReverseIterator::operator==(const Const
     return _node == iterator._node;
 }
 
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::link_front(Node* node)
+{
+    node->prev = nullptr;
+    node->next = _head;
+
+    if (_head)
+    {
+        _head->prev = node;
+    }
+    else
+    {
+        _tail = node;
+    }
+
+    _head = node;
+
+    ++_size;
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::link_back(Node* node)
+{
+    node->next = nullptr;
+    node->prev = _tail;
+
+    if (_tail)
+    {
+        _tail->next = node;
+    }
+    else
+    {
+        _head = node;
+    }
+
+    _tail = node;
+
+    ++_size;
+}
+
+template<typename T>
+void Dataplex::DoublyLinkedList<T>::unlink(Node* node)
+{
+    if (node->prev)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        _head = node->next;
+    }
+
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        _tail = node->prev;
+    }
+
+    node->next = nullptr;
+    node->prev = nullptr;
+
+    --_size;
+}
+
 template<typename T>
 void Dataplex::DoublyLinkedList<T>::swap(DoublyLinkedList<T>& list)
 {
@@ -8,7 +8,10 @@ http://inversepalindrome.com
 #pragma once
 
 #include <cstddef>
+#include <utility>
 #include <iterator>
+#include <stdexcept>
+#include <initializer_list>
 
 
 namespace Dataplex
@@ -42,15 +45,26 @@ namespace Dataplex
         T& operator[](std::size_t pos);
         const T& operator[](std::size_t pos) const;
 
+        T& head();
+        const T& head() const;
+
+        T& tail();
+        const T& tail() const;
+
         void push_back(const T& data);
         void push_back(T&& data);
 
+        template<typename... Args>
+        void emplace_back(Args&&... args);
+
+        void pop_front();
         void pop_back();
 
         void insert(const T& data, std::size_t pos);
         void insert(T&& data, std::size_t pos);
         void erase(std::size_t pos);
 
+        void resize(std::size_t size);
         void reserve(std::size_t capacity);
         void shrink_to_fit();
         void clear();
@@ -64,6 +78,9 @@ namespace Dataplex
         std::size_t _capacity;
         T* _array;
 
+        void grow();
+        void reallocate(std::size_t capacity);
+
         void swap(DynamicArray<T>& array);
     };
 }
@@ -80,6 +97,8 @@ template<typename T>
 Dataplex::DynamicArray<T>::DynamicArray(const DynamicArray<T>& array) :
     DynamicArray()
 {
+    reserve(array.size());
+
     for (std::size_t i = 0; i < array.size(); ++i)
     {
         push_back(array[i]);
@@ -193,12 +212,56 @@ const T& Dataplex::DynamicArray<T>::operator[](std::size_t pos) const
     return _array[pos];
 }
 
+template<typename T>
+T& Dataplex::DynamicArray<T>::head()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return _array[0];
+}
+
+template<typename T>
+const T& Dataplex::DynamicArray<T>::head() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return _array[0];
+}
+
+template<typename T>
+T& Dataplex::DynamicArray<T>::tail()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return _array[_size - 1];
+}
+
+template<typename T>
+const T& Dataplex::DynamicArray<T>::tail() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return _array[_size - 1];
+}
+
 template<typename T>
 void Dataplex::DynamicArray<T>::push_back(const T& data)
 {
     if (_size == _capacity)
     {
-        reserve(_capacity * 2);
+        grow();
     }
 
     _array[_size++] = data;
@@ -209,52 +272,68 @@ void Dataplex::DynamicArray<T>::push_back(T&& data)
 {
     if (_size == _capacity)
     {
-        reserve(_capacity * 2);
+        grow();
     }
 
     _array[_size++] = std::move(data);
 }
 
-template <typename T>
-void Dataplex::DynamicArray<T>::pop_back()
+template<typename T>
+template<typename... Args>
+void Dataplex::DynamicArray<T>::emplace_back(Args&&... args)
 {
-    if (is_empty())
+    if (_size == _capacity)
     {
-        throw std::out_of_range("Can't pop back empty dynamic array!");
+        grow();
     }
 
-    _array[_size--].~T();
+    _array[_size++] = T(std::forward<Args>(args)...);
 }
 
 template<typename T>
-void Dataplex::DynamicArray<T>::insert(const T& data, std::size_t pos)
+void Dataplex::DynamicArray<T>::pop_front()
 {
-    if (_size == _capacity)
+    if (is_empty())
     {
-        reserve(_capacity * 2);
+        throw std::out_of_range("Can't pop front empty dynamic array!");
     }
 
-    for (std::size_t i = _size - 1; i >= pos; --i)
+    erase(0);
+}
+
+template <typename T>
+void Dataplex::DynamicArray<T>::pop_back()
+{
+    if (is_empty())
     {
-        _array[i + 1] = _array[i];
+        throw std::out_of_range("Can't pop back empty dynamic array!");
     }
 
-    _array[pos] = data;
+    _array[--_size] = T();
+}
 
-    ++_size;
+template<typename T>
+void Dataplex::DynamicArray<T>::insert(const T& data, std::size_t pos)
+{
+    insert(T(data), pos);
 }
 
 template<typename T>
 void Dataplex::DynamicArray<T>::insert(T&& data, std::size_t pos)
 {
+    if (pos > _size)
+    {
+        throw std::out_of_range("Insert position outside of existing range!");
+    }
+
     if (_size == _capacity)
     {
-        reserve(_capacity * 2);
+        grow();
     }
 
-    for (std::size_t i = _size - 1; i >= pos; --i)
+    for (std::size_t i = _size; i > pos; --i)
     {
-        _array[i + 1] = _array[i];
+        _array[i] = std::move(_array[i - 1]);
     }
 
     _array[pos] = std::move(data);
@@ -270,38 +349,46 @@ void Dataplex::DynamicArray<T>::erase(std::size_t pos)
         throw std::out_of_range("Erase position outside of existing range!");
     }
 
-    _array[pos].~T();
-
-    for (std::size_t i = pos; i < _size; ++i)
+    for (std::size_t i = pos + 1; i < _size; ++i)
     {
-        _array[i] = _array[i + 1];
+        _array[i - 1] = std::move(_array[i]);
     }
 
-    --_size;
+    _array[--_size] = T();
 }
 
 template<typename T>
-void Dataplex::DynamicArray<T>::reserve(std::size_t capacity)
+void Dataplex::DynamicArray<T>::resize(std::size_t size)
 {
-    auto newArray = new T[capacity];
-
-    for (std::size_t i = 0; i < _size; ++i)
+    if (size > _capacity)
     {
-        newArray[i] = _array[i];
+        reserve(size);
     }
 
-    _capacity = capacity;
+    for (std::size_t i = _size; i < size; ++i)
+    {
+        _array[i] = T();
+    }
 
-    delete[] _array;
+    _size = size;
+}
 
-    _array = newArray;
+template<typename T>
+void Dataplex::DynamicArray<T>::reserve(std::size_t capacity)
+{
+    if (capacity > _capacity)
+    {
+        reallocate(capacity);
+    }
 }
 
 template<typename T>
 void Dataplex::DynamicArray<T>::shrink_to_fit()
 {
-    _capacity = _size;
-    reserve(_capacity);
+    if (_size < _capacity)
+    {
+        reallocate(_size);
+    }
 }
 
 template<typename T>
@@ -332,6 +419,29 @@ bool Dataplex::DynamicArray<T>::is_empty() const
     return _size == 0;
 }
 
+template<typename T>
+void Dataplex::DynamicArray<T>::grow()
+{
+    reserve(_capacity > 0 ? _capacity * 2 : 1);
+}
+
+template<typename T>
+void Dataplex::DynamicArray<T>::reallocate(std::size_t capacity)
+{
+    auto newArray = new T[capacity];
+
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+        newArray[i] = std::move(_array[i]);
+    }
+
+    _capacity = capacity;
+
+    delete[] _array;
+
+    _array = newArray;
+}
+
 template<typename T>
 void Dataplex::DynamicArray<T>::swap(DynamicArray<T>& array)
 {
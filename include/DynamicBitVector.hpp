@@ -0,0 +1,426 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - DynamicBitVector.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace Dataplex
+{
+    class DynamicBitVector
+    {
+    public:
+        DynamicBitVector();
+        explicit DynamicBitVector(std::size_t size, bool value = false);
+
+        bool operator[](std::size_t pos) const;
+        bool test(std::size_t pos) const;
+
+        void set(std::size_t pos, bool value = true);
+        void reset(std::size_t pos);
+        void flip(std::size_t pos);
+
+        void set_all();
+        void reset_all();
+        void flip_all();
+
+        void push_back(bool value);
+        void pop_back();
+
+        void resize(std::size_t size, bool value = false);
+        void clear();
+
+        DynamicBitVector& operator&=(const DynamicBitVector& bitVector);
+        DynamicBitVector& operator|=(const DynamicBitVector& bitVector);
+        DynamicBitVector& operator^=(const DynamicBitVector& bitVector);
+        DynamicBitVector& and_not(const DynamicBitVector& bitVector);
+
+        bool operator==(const DynamicBitVector& bitVector) const;
+        bool operator!=(const DynamicBitVector& bitVector) const;
+
+        std::size_t count() const;
+        bool all() const;
+        bool any() const;
+        bool none() const;
+
+        std::size_t find_first() const;
+        std::size_t find_next(std::size_t pos) const;
+
+        void build_rank_index();
+        bool has_rank_index() const;
+
+        std::size_t rank(std::size_t pos) const;
+        std::size_t select(std::size_t rank) const;
+
+        const DynamicArray<std::uint64_t>& words() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t SuperblockWords = 8;
+
+        DynamicArray<std::uint64_t> _words;
+        DynamicArray<std::uint64_t> _ranks;
+        std::size_t _size;
+        bool _indexed;
+
+        template<detail::BitOperation Operation>
+        DynamicBitVector& combine(const DynamicBitVector& bitVector);
+
+        void clear_tail();
+        void check_position(std::size_t pos) const;
+        void check_rank_index() const;
+    };
+}
+
+inline Dataplex::DynamicBitVector::DynamicBitVector() :
+    _size(0),
+    _indexed(false)
+{
+}
+
+inline Dataplex::DynamicBitVector::DynamicBitVector(std::size_t size, bool value) :
+    DynamicBitVector()
+{
+    resize(size, value);
+}
+
+inline bool Dataplex::DynamicBitVector::operator[](std::size_t pos) const
+{
+    return (_words[pos / detail::WordBits] >> (pos % detail::WordBits)) & 1;
+}
+
+inline bool Dataplex::DynamicBitVector::test(std::size_t pos) const
+{
+    check_position(pos);
+
+    return (*this)[pos];
+}
+
+inline void Dataplex::DynamicBitVector::set(std::size_t pos, bool value)
+{
+    check_position(pos);
+
+    auto& word = _words[pos / detail::WordBits];
+    auto mask = std::uint64_t(1) << (pos % detail::WordBits);
+
+    word = value ? word | mask : word & ~mask;
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::reset(std::size_t pos)
+{
+    set(pos, false);
+}
+
+inline void Dataplex::DynamicBitVector::flip(std::size_t pos)
+{
+    check_position(pos);
+
+    _words[pos / detail::WordBits] ^= std::uint64_t(1) << (pos % detail::WordBits);
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::set_all()
+{
+    std::fill(_words.begin(), _words.end(), ~std::uint64_t(0));
+
+    clear_tail();
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::reset_all()
+{
+    std::fill(_words.begin(), _words.end(), 0);
+
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::flip_all()
+{
+    for (auto& word : _words)
+    {
+        word = ~word;
+    }
+
+    clear_tail();
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::push_back(bool value)
+{
+    if (_size % detail::WordBits == 0)
+    {
+        _words.push_back(0);
+    }
+
+    _words.tail() |= std::uint64_t(value) << (_size % detail::WordBits);
+
+    ++_size;
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::pop_back()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop back empty bit vector!");
+    }
+
+    if (--_size % detail::WordBits == 0)
+    {
+        _words.pop_back();
+    }
+    else
+    {
+        clear_tail();
+    }
+
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::resize(std::size_t size, bool value)
+{
+    auto oldSize = _size;
+
+    _words.resize(detail::word_count(size));
+    _size = size;
+
+    if (value && size > oldSize)
+    {
+        auto first = oldSize / detail::WordBits;
+
+        if (oldSize % detail::WordBits != 0)
+        {
+            _words[first++] |= ~std::uint64_t(0) << (oldSize % detail::WordBits);
+        }
+
+        std::fill(_words.begin() + first, _words.end(), ~std::uint64_t(0));
+    }
+
+    clear_tail();
+    _indexed = false;
+}
+
+inline void Dataplex::DynamicBitVector::clear()
+{
+    _words.clear();
+    _ranks.clear();
+
+    _size = 0;
+    _indexed = false;
+}
+
+inline Dataplex::DynamicBitVector& Dataplex::DynamicBitVector::operator&=(const DynamicBitVector& bitVector)
+{
+    return combine<detail::BitOperation::And>(bitVector);
+}
+
+inline Dataplex::DynamicBitVector& Dataplex::DynamicBitVector::operator|=(const DynamicBitVector& bitVector)
+{
+    return combine<detail::BitOperation::Or>(bitVector);
+}
+
+inline Dataplex::DynamicBitVector& Dataplex::DynamicBitVector::operator^=(const DynamicBitVector& bitVector)
+{
+    return combine<detail::BitOperation::Xor>(bitVector);
+}
+
+inline Dataplex::DynamicBitVector& Dataplex::DynamicBitVector::and_not(const DynamicBitVector& bitVector)
+{
+    return combine<detail::BitOperation::AndNot>(bitVector);
+}
+
+inline bool Dataplex::DynamicBitVector::operator==(const DynamicBitVector& bitVector) const
+{
+    return _size == bitVector._size && std::equal(_words.begin(), _words.end(), bitVector._words.begin());
+}
+
+inline bool Dataplex::DynamicBitVector::operator!=(const DynamicBitVector& bitVector) const
+{
+    return !(*this == bitVector);
+}
+
+inline std::size_t Dataplex::DynamicBitVector::count() const
+{
+    if (_indexed)
+    {
+        return static_cast<std::size_t>(_ranks.tail());
+    }
+
+    return detail::popcount_words(_words.begin(), _words.size());
+}
+
+inline bool Dataplex::DynamicBitVector::all() const
+{
+    return count() == _size;
+}
+
+inline bool Dataplex::DynamicBitVector::any() const
+{
+    return std::any_of(_words.begin(), _words.end(), [](auto word) { return word != 0; });
+}
+
+inline bool Dataplex::DynamicBitVector::none() const
+{
+    return !any();
+}
+
+inline std::size_t Dataplex::DynamicBitVector::find_first() const
+{
+    return std::min(detail::find_next_word_bit(_words.begin(), _words.size(), 0), _size);
+}
+
+inline std::size_t Dataplex::DynamicBitVector::find_next(std::size_t pos) const
+{
+    if (pos + 1 >= _size)
+    {
+        return _size;
+    }
+
+    return std::min(detail::find_next_word_bit(_words.begin(), _words.size(), pos + 1), _size);
+}
+
+inline void Dataplex::DynamicBitVector::build_rank_index()
+{
+    auto superblocks = (_words.size() + SuperblockWords - 1) / SuperblockWords;
+
+    _ranks.clear();
+    _ranks.reserve(superblocks + 1);
+
+    std::uint64_t total = 0;
+
+    for (std::size_t superblock = 0; superblock < superblocks; ++superblock)
+    {
+        auto first = superblock * SuperblockWords;
+        auto count = std::min(SuperblockWords, _words.size() - first);
+
+        _ranks.push_back(total);
+        total += detail::popcount_words(_words.begin() + first, count);
+    }
+
+    _ranks.push_back(total);
+    _indexed = true;
+}
+
+inline bool Dataplex::DynamicBitVector::has_rank_index() const
+{
+    return _indexed;
+}
+
+inline std::size_t Dataplex::DynamicBitVector::rank(std::size_t pos) const
+{
+    check_rank_index();
+
+    if (pos > _size)
+    {
+        throw std::out_of_range("Rank position out of range!");
+    }
+
+    auto word = pos / detail::WordBits;
+    auto superblock = word / SuperblockWords;
+    auto result = static_cast<std::size_t>(_ranks[superblock]);
+
+    for (auto i = superblock * SuperblockWords; i < word; ++i)
+    {
+        result += static_cast<std::size_t>(detail::popcount(_words[i]));
+    }
+
+    if (pos % detail::WordBits != 0)
+    {
+        result += static_cast<std::size_t>(detail::popcount(_words[word] & detail::tail_mask(pos)));
+    }
+
+    return result;
+}
+
+inline std::size_t Dataplex::DynamicBitVector::select(std::size_t rank) const
+{
+    check_rank_index();
+
+    if (rank >= count())
+    {
+        throw std::out_of_range("Select rank out of range!");
+    }
+
+    auto superblock = static_cast<std::size_t>(std::upper_bound(_ranks.begin(), _ranks.end(), rank) - _ranks.begin()) - 1;
+    auto remaining = rank - static_cast<std::size_t>(_ranks[superblock]);
+
+    for (auto word = superblock * SuperblockWords; ; ++word)
+    {
+        auto bits = static_cast<std::size_t>(detail::popcount(_words[word]));
+
+        if (remaining < bits)
+        {
+            return word * detail::WordBits + detail::select_in_word(_words[word], remaining);
+        }
+
+        remaining -= bits;
+    }
+}
+
+inline const Dataplex::DynamicArray<std::uint64_t>& Dataplex::DynamicBitVector::words() const
+{
+    return _words;
+}
+
+inline std::size_t Dataplex::DynamicBitVector::size() const
+{
+    return _size;
+}
+
+inline bool Dataplex::DynamicBitVector::is_empty() const
+{
+    return _size == 0;
+}
+
+template<Dataplex::detail::BitOperation Operation>
+Dataplex::DynamicBitVector& Dataplex::DynamicBitVector::combine(const DynamicBitVector& bitVector)
+{
+    if (_size != bitVector._size)
+    {
+        throw std::invalid_argument("Bit vectors must have the same size!");
+    }
+
+    detail::combine_words<Operation>(_words.begin(), bitVector._words.begin(), _words.size());
+
+    _indexed = false;
+
+    return *this;
+}
+
+inline void Dataplex::DynamicBitVector::clear_tail()
+{
+    if (_size % detail::WordBits != 0)
+    {
+        _words.tail() &= detail::tail_mask(_size);
+    }
+}
+
+inline void Dataplex::DynamicBitVector::check_position(std::size_t pos) const
+{
+    if (pos >= _size)
+    {
+        throw std::out_of_range("Bit position out of range!");
+    }
+}
+
+inline void Dataplex::DynamicBitVector::check_rank_index() const
+{
+    if (!_indexed)
+    {
+        throw std::logic_error("Rank index must be built before rank or select!");
+    }
+}
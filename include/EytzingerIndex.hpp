@@ -0,0 +1,276 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - EytzingerIndex.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Search.hpp"
+#include "StaticArray.hpp"
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        template<typename Layout, typename Positions, typename Sorted>
+        constexpr std::size_t eytzinger_fill(Layout& layout, Positions& positions, const Sorted& sorted,
+            std::size_t index, std::size_t node, std::size_t count);
+
+        template<typename T, typename Predicate>
+        std::size_t eytzinger_search(const T* layout, std::size_t count, Predicate goes_right);
+    }
+
+    template<typename T, typename Compare = std::less<T>>
+    class EytzingerIndex
+    {
+    public:
+        explicit EytzingerIndex(const DynamicArray<T>& sorted, const Compare& comp = Compare());
+
+        template<std::size_t N>
+        explicit EytzingerIndex(const StaticArray<T, N>& sorted, const Compare& comp = Compare());
+
+        std::size_t lower_bound(const T& key) const;
+        std::size_t upper_bound(const T& key) const;
+
+        std::size_t find(const T& key) const;
+        bool contains(const T& key) const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        DynamicArray<T> _layout;
+        DynamicArray<std::size_t> _positions;
+        std::size_t _size;
+        Compare _comp;
+
+        template<typename Sorted>
+        void build(const Sorted& sorted);
+    };
+
+    template<typename T, std::size_t N, typename Compare = std::less<T>>
+    class StaticEytzingerIndex
+    {
+    public:
+        constexpr explicit StaticEytzingerIndex(const StaticArray<T, N>& sorted, const Compare& comp = Compare());
+
+        std::size_t lower_bound(const T& key) const;
+        std::size_t upper_bound(const T& key) const;
+
+        std::size_t find(const T& key) const;
+        bool contains(const T& key) const;
+
+        constexpr std::size_t size() const;
+        constexpr bool is_empty() const;
+
+    private:
+        StaticArray<T, N + 1> _layout;
+        StaticArray<std::size_t, N + 1> _positions;
+        Compare _comp;
+    };
+}
+
+template<typename Layout, typename Positions, typename Sorted>
+constexpr std::size_t Dataplex::detail::eytzinger_fill(Layout& layout, Positions& positions, const Sorted& sorted,
+    std::size_t index, std::size_t node, std::size_t count)
+{
+    if (node <= count)
+    {
+        index = eytzinger_fill(layout, positions, sorted, index, 2 * node, count);
+
+        layout[node] = sorted[index];
+        positions[node] = index++;
+
+        index = eytzinger_fill(layout, positions, sorted, index, 2 * node + 1, count);
+    }
+
+    return index;
+}
+
+template<typename T, typename Predicate>
+std::size_t Dataplex::detail::eytzinger_search(const T* layout, std::size_t count, Predicate goes_right)
+{
+    constexpr std::size_t Lanes = std::max<std::size_t>(64 / sizeof(T), 1);
+
+    std::size_t node = 1;
+
+    while (node <= count)
+    {
+        prefetch(layout + node * Lanes);
+
+        node = 2 * node + (goes_right(layout[node]) ? 1 : 0);
+    }
+
+    return node >> (count_trailing_zeros(~node) + 1);
+}
+
+template<typename T, typename Compare>
+Dataplex::EytzingerIndex<T, Compare>::EytzingerIndex(const DynamicArray<T>& sorted, const Compare& comp) :
+    _layout(),
+    _positions(),
+    _size(sorted.size()),
+    _comp(comp)
+{
+    build(sorted);
+}
+
+template<typename T, typename Compare>
+template<std::size_t N>
+Dataplex::EytzingerIndex<T, Compare>::EytzingerIndex(const StaticArray<T, N>& sorted, const Compare& comp) :
+    _layout(),
+    _positions(),
+    _size(N),
+    _comp(comp)
+{
+    build(sorted);
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::EytzingerIndex<T, Compare>::lower_bound(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), _size, [this, &key](const T& element)
+    {
+        return _comp(element, key);
+    });
+
+    return _positions[node];
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::EytzingerIndex<T, Compare>::upper_bound(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), _size, [this, &key](const T& element)
+    {
+        return !_comp(key, element);
+    });
+
+    return _positions[node];
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::EytzingerIndex<T, Compare>::find(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), _size, [this, &key](const T& element)
+    {
+        return _comp(element, key);
+    });
+
+    return node != 0 && !_comp(key, _layout[node]) ? _positions[node] : _size;
+}
+
+template<typename T, typename Compare>
+bool Dataplex::EytzingerIndex<T, Compare>::contains(const T& key) const
+{
+    return find(key) != _size;
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::EytzingerIndex<T, Compare>::size() const
+{
+    return _size;
+}
+
+template<typename T, typename Compare>
+bool Dataplex::EytzingerIndex<T, Compare>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T, typename Compare>
+template<typename Sorted>
+void Dataplex::EytzingerIndex<T, Compare>::build(const Sorted& sorted)
+{
+    for (std::size_t i = 1; i < _size; ++i)
+    {
+        if (_comp(sorted[i], sorted[i - 1]))
+        {
+            throw std::invalid_argument("Eytzinger index needs sorted input!");
+        }
+    }
+
+    _layout.resize(_size + 1);
+    _positions.resize(_size + 1);
+    _positions[0] = _size;
+
+    detail::eytzinger_fill(_layout, _positions, sorted, 0, 1, _size);
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr Dataplex::StaticEytzingerIndex<T, N, Compare>::StaticEytzingerIndex(const StaticArray<T, N>& sorted, const Compare& comp) :
+    _layout(),
+    _positions(),
+    _comp(comp)
+{
+    for (std::size_t i = 1; i < N; ++i)
+    {
+        if (_comp(sorted[i], sorted[i - 1]))
+        {
+            throw std::invalid_argument("Eytzinger index needs sorted input!");
+        }
+    }
+
+    _positions[0] = N;
+
+    detail::eytzinger_fill(_layout, _positions, sorted, 0, 1, N);
+}
+
+template<typename T, std::size_t N, typename Compare>
+std::size_t Dataplex::StaticEytzingerIndex<T, N, Compare>::lower_bound(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), N, [this, &key](const T& element)
+    {
+        return _comp(element, key);
+    });
+
+    return _positions[node];
+}
+
+template<typename T, std::size_t N, typename Compare>
+std::size_t Dataplex::StaticEytzingerIndex<T, N, Compare>::upper_bound(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), N, [this, &key](const T& element)
+    {
+        return !_comp(key, element);
+    });
+
+    return _positions[node];
+}
+
+template<typename T, std::size_t N, typename Compare>
+std::size_t Dataplex::StaticEytzingerIndex<T, N, Compare>::find(const T& key) const
+{
+    auto node = detail::eytzinger_search(_layout.begin(), N, [this, &key](const T& element)
+    {
+        return _comp(element, key);
+    });
+
+    return node != 0 && !_comp(key, _layout[node]) ? _positions[node] : N;
+}
+
+template<typename T, std::size_t N, typename Compare>
+bool Dataplex::StaticEytzingerIndex<T, N, Compare>::contains(const T& key) const
+{
+    return find(key) != N;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr std::size_t Dataplex::StaticEytzingerIndex<T, N, Compare>::size() const
+{
+    return N;
+}
+
+template<typename T, std::size_t N, typename Compare>
+constexpr bool Dataplex::StaticEytzingerIndex<T, N, Compare>::is_empty() const
+{
+    return N == 0;
+}
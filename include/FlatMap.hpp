@@ -0,0 +1,549 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - FlatMap.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Sort.hpp"
+#include "Search.hpp"
+#include "DynamicArray.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class FlatMap
+    {
+    public:
+        FlatMap();
+        explicit FlatMap(const Compare& comp);
+        FlatMap(DynamicArray<Key> keys, DynamicArray<Value> values, const Compare& comp = Compare());
+        FlatMap(std::initializer_list<std::pair<Key, Value>> list);
+
+        class Iterator;
+        class ConstIterator;
+
+        Iterator begin();
+        ConstIterator begin() const;
+
+        Iterator end();
+        ConstIterator end() const;
+
+        Value& operator[](const Key& key);
+
+        Value& at(const Key& key);
+        const Value& at(const Key& key) const;
+
+        Iterator find(const Key& key);
+        ConstIterator find(const Key& key) const;
+
+        bool contains(const Key& key) const;
+
+        Iterator lower_bound(const Key& key);
+        ConstIterator lower_bound(const Key& key) const;
+
+        Iterator upper_bound(const Key& key);
+        ConstIterator upper_bound(const Key& key) const;
+
+        bool insert(const Key& key, const Value& value);
+        bool insert(Key&& key, Value&& value);
+        bool erase(const Key& key);
+
+        void merge(const FlatMap<Key, Value, Compare>& map);
+        void merge(DynamicArray<Key> keys, DynamicArray<Value> values);
+
+        void reserve(std::size_t capacity);
+        void clear();
+
+        const DynamicArray<Key>& keys() const;
+        const DynamicArray<Value>& values() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        DynamicArray<Key> _keys;
+        DynamicArray<Value> _values;
+        Compare _comp;
+
+        std::size_t find_index(const Key& key) const;
+        void sort_entries();
+
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = std::pair<const Key&, Value&>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::pair<const Key&, Value&>;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator();
+            Iterator(const Key* keys, Value* values, std::size_t index);
+
+            std::pair<const Key&, Value&> operator*() const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            bool operator==(const Iterator& iterator) const;
+            bool operator!=(const Iterator& iterator) const;
+
+        private:
+            const Key* _keys;
+            Value* _values;
+            std::size_t _index;
+        };
+
+        class ConstIterator
+        {
+        public:
+            using value_type = std::pair<const Key&, const Value&>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::pair<const Key&, const Value&>;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(const Key* keys, const Value* values, std::size_t index);
+
+            std::pair<const Key&, const Value&> operator*() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const Key* _keys;
+            const Value* _values;
+            std::size_t _index;
+        };
+    };
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::FlatMap() :
+    FlatMap(Compare())
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::FlatMap(const Compare& comp) :
+    _comp(comp)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::FlatMap(DynamicArray<Key> keys, DynamicArray<Value> values, const Compare& comp) :
+    _keys(std::move(keys)),
+    _values(std::move(values)),
+    _comp(comp)
+{
+    if (_keys.size() != _values.size())
+    {
+        throw std::invalid_argument("Flat map needs one value per key!");
+    }
+
+    sort_entries();
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::FlatMap(std::initializer_list<std::pair<Key, Value>> list) :
+    FlatMap()
+{
+    _keys.reserve(list.size());
+    _values.reserve(list.size());
+
+    for (const auto& entry : list)
+    {
+        _keys.push_back(entry.first);
+        _values.push_back(entry.second);
+    }
+
+    sort_entries();
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::begin()
+{
+    return Iterator(_keys.begin(), _values.begin(), 0);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::begin() const
+{
+    return ConstIterator(_keys.begin(), _values.begin(), 0);
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::end()
+{
+    return Iterator(_keys.begin(), _values.begin(), size());
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::end() const
+{
+    return ConstIterator(_keys.begin(), _values.begin(), size());
+}
+
+template<typename Key, typename Value, typename Compare>
+Value& Dataplex::FlatMap<Key, Value, Compare>::operator[](const Key& key)
+{
+    auto index = detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+
+    if (index == size() || _comp(key, _keys[index]))
+    {
+        _keys.insert(key, index);
+        _values.insert(Value(), index);
+    }
+
+    return _values[index];
+}
+
+template<typename Key, typename Value, typename Compare>
+Value& Dataplex::FlatMap<Key, Value, Compare>::at(const Key& key)
+{
+    auto index = find_index(key);
+
+    if (index == size())
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return _values[index];
+}
+
+template<typename Key, typename Value, typename Compare>
+const Value& Dataplex::FlatMap<Key, Value, Compare>::at(const Key& key) const
+{
+    auto index = find_index(key);
+
+    if (index == size())
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return _values[index];
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::find(const Key& key)
+{
+    return Iterator(_keys.begin(), _values.begin(), find_index(key));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::find(const Key& key) const
+{
+    return ConstIterator(_keys.begin(), _values.begin(), find_index(key));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::contains(const Key& key) const
+{
+    return find_index(key) != size();
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::lower_bound(const Key& key)
+{
+    return Iterator(_keys.begin(), _values.begin(), detail::branchless_lower_bound(_keys.begin(), size(), key, _comp));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::lower_bound(const Key& key) const
+{
+    return ConstIterator(_keys.begin(), _values.begin(), detail::branchless_lower_bound(_keys.begin(), size(), key, _comp));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::upper_bound(const Key& key)
+{
+    return Iterator(_keys.begin(), _values.begin(), detail::branchless_upper_bound(_keys.begin(), size(), key, _comp));
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::upper_bound(const Key& key) const
+{
+    return ConstIterator(_keys.begin(), _values.begin(), detail::branchless_upper_bound(_keys.begin(), size(), key, _comp));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::insert(const Key& key, const Value& value)
+{
+    return insert(Key(key), Value(value));
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::insert(Key&& key, Value&& value)
+{
+    auto index = detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+
+    if (index < size() && !_comp(key, _keys[index]))
+    {
+        return false;
+    }
+
+    _keys.insert(std::move(key), index);
+    _values.insert(std::move(value), index);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::erase(const Key& key)
+{
+    auto index = find_index(key);
+
+    if (index == size())
+    {
+        return false;
+    }
+
+    _keys.erase(index);
+    _values.erase(index);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::FlatMap<Key, Value, Compare>::merge(const FlatMap<Key, Value, Compare>& map)
+{
+    DynamicArray<Key> keys(size() + map.size());
+    DynamicArray<Value> values(size() + map.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    while (i < size() || j < map.size())
+    {
+        if (j == map.size() || (i < size() && _comp(_keys[i], map._keys[j])))
+        {
+            keys.push_back(std::move(_keys[i]));
+            values.push_back(std::move(_values[i++]));
+        }
+        else
+        {
+            if (i < size() && !_comp(map._keys[j], _keys[i]))
+            {
+                ++i;
+            }
+
+            keys.push_back(map._keys[j]);
+            values.push_back(map._values[j++]);
+        }
+    }
+
+    _keys = std::move(keys);
+    _values = std::move(values);
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::FlatMap<Key, Value, Compare>::merge(DynamicArray<Key> keys, DynamicArray<Value> values)
+{
+    merge(FlatMap<Key, Value, Compare>(std::move(keys), std::move(values), _comp));
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::FlatMap<Key, Value, Compare>::reserve(std::size_t capacity)
+{
+    _keys.reserve(capacity);
+    _values.reserve(capacity);
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::FlatMap<Key, Value, Compare>::clear()
+{
+    _keys.clear();
+    _values.clear();
+}
+
+template<typename Key, typename Value, typename Compare>
+const Dataplex::DynamicArray<Key>& Dataplex::FlatMap<Key, Value, Compare>::keys() const
+{
+    return _keys;
+}
+
+template<typename Key, typename Value, typename Compare>
+const Dataplex::DynamicArray<Value>& Dataplex::FlatMap<Key, Value, Compare>::values() const
+{
+    return _values;
+}
+
+template<typename Key, typename Value, typename Compare>
+std::size_t Dataplex::FlatMap<Key, Value, Compare>::size() const
+{
+    return _keys.size();
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::is_empty() const
+{
+    return _keys.is_empty();
+}
+
+template<typename Key, typename Value, typename Compare>
+std::size_t Dataplex::FlatMap<Key, Value, Compare>::find_index(const Key& key) const
+{
+    auto index = detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+
+    return index < size() && !_comp(key, _keys[index]) ? index : size();
+}
+
+template<typename Key, typename Value, typename Compare>
+void Dataplex::FlatMap<Key, Value, Compare>::sort_entries()
+{
+    auto sorted = true;
+
+    for (std::size_t i = 1; i < size() && sorted; ++i)
+    {
+        sorted = _comp(_keys[i - 1], _keys[i]);
+    }
+
+    if (sorted)
+    {
+        return;
+    }
+
+    DynamicArray<std::size_t> order(size());
+
+    for (std::size_t i = 0; i < size(); ++i)
+    {
+        order.push_back(i);
+    }
+
+    pdq_sort(order, [this](std::size_t left, std::size_t right)
+    {
+        return _comp(_keys[left], _keys[right]) || (!_comp(_keys[right], _keys[left]) && left < right);
+    });
+
+    DynamicArray<Key> keys(size());
+    DynamicArray<Value> values(size());
+
+    for (auto index : order)
+    {
+        if (keys.is_empty() || _comp(keys.tail(), _keys[index]))
+        {
+            keys.push_back(std::move(_keys[index]));
+            values.push_back(std::move(_values[index]));
+        }
+    }
+
+    _keys = std::move(keys);
+    _values = std::move(values);
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::Iterator::Iterator() :
+    _keys(nullptr),
+    _values(nullptr),
+    _index(0)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::Iterator::Iterator(const Key* keys, Value* values, std::size_t index) :
+    _keys(keys),
+    _values(values),
+    _index(index)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<const Key&, Value&> Dataplex::FlatMap<Key, Value, Compare>::Iterator::operator*() const
+{
+    return { _keys[_index], _values[_index] };
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator& Dataplex::FlatMap<Key, Value, Compare>::Iterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::Iterator Dataplex::FlatMap<Key, Value, Compare>::Iterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::Iterator::operator==(const Iterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::Iterator::operator!=(const Iterator& iterator) const
+{
+    return _index != iterator._index;
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::ConstIterator() :
+    _keys(nullptr),
+    _values(nullptr),
+    _index(0)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::ConstIterator(const Key* keys, const Value* values, std::size_t index) :
+    _keys(keys),
+    _values(values),
+    _index(index)
+{
+}
+
+template<typename Key, typename Value, typename Compare>
+std::pair<const Key&, const Value&> Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::operator*() const
+{
+    return { _keys[_index], _values[_index] };
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator& Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename Dataplex::FlatMap<Key, Value, Compare>::ConstIterator Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename Key, typename Value, typename Compare>
+bool Dataplex::FlatMap<Key, Value, Compare>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _index != iterator._index;
+}
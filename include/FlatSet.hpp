@@ -0,0 +1,264 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - FlatSet.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Sort.hpp"
+#include "Search.hpp"
+#include "DynamicArray.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Compare = std::less<Key>>
+    class FlatSet
+    {
+    public:
+        FlatSet();
+        explicit FlatSet(const Compare& comp);
+        explicit FlatSet(DynamicArray<Key> keys, const Compare& comp = Compare());
+        FlatSet(std::initializer_list<Key> list);
+
+        const Key* begin() const;
+        const Key* end() const;
+
+        const Key* find(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        const Key* lower_bound(const Key& key) const;
+        const Key* upper_bound(const Key& key) const;
+
+        bool insert(const Key& key);
+        bool insert(Key&& key);
+        bool erase(const Key& key);
+
+        void merge(const FlatSet<Key, Compare>& set);
+        void merge(DynamicArray<Key> keys);
+
+        void reserve(std::size_t capacity);
+        void clear();
+
+        const DynamicArray<Key>& keys() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        DynamicArray<Key> _keys;
+        Compare _comp;
+
+        std::size_t find_index(const Key& key) const;
+        void sort_keys();
+    };
+}
+
+template<typename Key, typename Compare>
+Dataplex::FlatSet<Key, Compare>::FlatSet() :
+    FlatSet(Compare())
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::FlatSet<Key, Compare>::FlatSet(const Compare& comp) :
+    _comp(comp)
+{
+}
+
+template<typename Key, typename Compare>
+Dataplex::FlatSet<Key, Compare>::FlatSet(DynamicArray<Key> keys, const Compare& comp) :
+    _keys(std::move(keys)),
+    _comp(comp)
+{
+    sort_keys();
+}
+
+template<typename Key, typename Compare>
+Dataplex::FlatSet<Key, Compare>::FlatSet(std::initializer_list<Key> list) :
+    FlatSet(DynamicArray<Key>(list))
+{
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::FlatSet<Key, Compare>::begin() const
+{
+    return _keys.begin();
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::FlatSet<Key, Compare>::end() const
+{
+    return _keys.end();
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::FlatSet<Key, Compare>::find(const Key& key) const
+{
+    return _keys.begin() + find_index(key);
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::FlatSet<Key, Compare>::contains(const Key& key) const
+{
+    return find_index(key) != size();
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::FlatSet<Key, Compare>::lower_bound(const Key& key) const
+{
+    return _keys.begin() + detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+}
+
+template<typename Key, typename Compare>
+const Key* Dataplex::FlatSet<Key, Compare>::upper_bound(const Key& key) const
+{
+    return _keys.begin() + detail::branchless_upper_bound(_keys.begin(), size(), key, _comp);
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::FlatSet<Key, Compare>::insert(const Key& key)
+{
+    return insert(Key(key));
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::FlatSet<Key, Compare>::insert(Key&& key)
+{
+    auto index = detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+
+    if (index < size() && !_comp(key, _keys[index]))
+    {
+        return false;
+    }
+
+    _keys.insert(std::move(key), index);
+
+    return true;
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::FlatSet<Key, Compare>::erase(const Key& key)
+{
+    auto index = find_index(key);
+
+    if (index == size())
+    {
+        return false;
+    }
+
+    _keys.erase(index);
+
+    return true;
+}
+
+template<typename Key, typename Compare>
+void Dataplex::FlatSet<Key, Compare>::merge(const FlatSet<Key, Compare>& set)
+{
+    DynamicArray<Key> keys(size() + set.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    while (i < size() || j < set.size())
+    {
+        if (j == set.size() || (i < size() && _comp(_keys[i], set._keys[j])))
+        {
+            keys.push_back(std::move(_keys[i++]));
+        }
+        else
+        {
+            if (i < size() && !_comp(set._keys[j], _keys[i]))
+            {
+                ++i;
+            }
+
+            keys.push_back(set._keys[j++]);
+        }
+    }
+
+    _keys = std::move(keys);
+}
+
+template<typename Key, typename Compare>
+void Dataplex::FlatSet<Key, Compare>::merge(DynamicArray<Key> keys)
+{
+    merge(FlatSet<Key, Compare>(std::move(keys), _comp));
+}
+
+template<typename Key, typename Compare>
+void Dataplex::FlatSet<Key, Compare>::reserve(std::size_t capacity)
+{
+    _keys.reserve(capacity);
+}
+
+template<typename Key, typename Compare>
+void Dataplex::FlatSet<Key, Compare>::clear()
+{
+    _keys.clear();
+}
+
+template<typename Key, typename Compare>
+const Dataplex::DynamicArray<Key>& Dataplex::FlatSet<Key, Compare>::keys() const
+{
+    return _keys;
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::FlatSet<Key, Compare>::size() const
+{
+    return _keys.size();
+}
+
+template<typename Key, typename Compare>
+bool Dataplex::FlatSet<Key, Compare>::is_empty() const
+{
+    return _keys.is_empty();
+}
+
+template<typename Key, typename Compare>
+std::size_t Dataplex::FlatSet<Key, Compare>::find_index(const Key& key) const
+{
+    auto index = detail::branchless_lower_bound(_keys.begin(), size(), key, _comp);
+
+    return index < size() && !_comp(key, _keys[index]) ? index : size();
+}
+
+template<typename Key, typename Compare>
+void Dataplex::FlatSet<Key, Compare>::sort_keys()
+{
+    auto sorted = true;
+
+    for (std::size_t i = 1; i < size() && sorted; ++i)
+    {
+        sorted = _comp(_keys[i - 1], _keys[i]);
+    }
+
+    if (sorted)
+    {
+        return;
+    }
+
+    pdq_sort(_keys, _comp);
+
+    std::size_t unique = 1;
+
+    for (std::size_t i = 1; i < size(); ++i)
+    {
+        if (_comp(_keys[unique - 1], _keys[i]))
+        {
+            _keys[unique++] = std::move(_keys[i]);
+        }
+    }
+
+    while (size() > unique)
+    {
+        _keys.pop_back();
+    }
+}
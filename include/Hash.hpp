@@ -0,0 +1,439 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Hash.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace Dataplex
+{
+    namespace hash
+    {
+        namespace detail
+        {
+            constexpr std::uint64_t Secret[4] =
+            {
+                0xA0761D6478BD642F, 0xE7037ED1A0B428DB, 0x8EBC6AF09C88C6E3, 0x589965CC75374CC3
+            };
+
+            constexpr std::size_t StripeBytes = 64;
+            constexpr std::size_t StripesPerBlock = 16;
+            constexpr std::size_t LongThreshold = 256;
+            constexpr std::uint64_t ScramblePrime = 0x9E3779B1;
+
+            void multiply(std::uint64_t& low, std::uint64_t& high);
+            std::uint64_t mix(std::uint64_t left, std::uint64_t right);
+
+            std::uint64_t read64(const std::uint8_t* data);
+            std::uint64_t read32(const std::uint8_t* data);
+            std::uint64_t read_small(const std::uint8_t* data, std::size_t length);
+
+            void accumulate(std::uint64_t* accumulators, const std::uint8_t* data, const std::uint64_t* keys);
+            void scramble(std::uint64_t* accumulators, const std::uint64_t* keys);
+
+            std::uint64_t hash_short(const std::uint8_t* data, std::size_t length, std::uint64_t seed);
+            std::uint64_t hash_long(const std::uint8_t* data, std::size_t length, std::uint64_t seed);
+        }
+
+        std::uint64_t seed();
+
+        std::uint64_t mix64(std::uint64_t value);
+        std::uint64_t mix64(std::uint64_t value, std::uint64_t seed);
+
+        std::uint64_t hash_bytes(const void* data, std::size_t length);
+        std::uint64_t hash_bytes(const void* data, std::size_t length, std::uint64_t seed);
+
+        template<typename T>
+        class Hash
+        {
+        public:
+            Hash();
+            explicit Hash(std::uint64_t seed);
+
+            std::size_t operator()(const T& value) const;
+
+        private:
+            std::uint64_t _seed;
+        };
+
+        template<>
+        class Hash<std::string>
+        {
+        public:
+            using is_transparent = void;
+
+            Hash();
+            explicit Hash(std::uint64_t seed);
+
+            std::size_t operator()(const std::string& value) const;
+            std::size_t operator()(std::string_view value) const;
+            std::size_t operator()(const char* value) const;
+
+        private:
+            std::uint64_t _seed;
+        };
+
+        template<>
+        class Hash<std::string_view>
+        {
+        public:
+            using is_transparent = void;
+
+            Hash();
+            explicit Hash(std::uint64_t seed);
+
+            std::size_t operator()(std::string_view value) const;
+
+        private:
+            std::uint64_t _seed;
+        };
+    }
+}
+
+inline void Dataplex::hash::detail::multiply(std::uint64_t& low, std::uint64_t& high)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using Product = unsigned __int128;
+
+    auto product = static_cast<Product>(low) * high;
+
+    low = static_cast<std::uint64_t>(product);
+    high = static_cast<std::uint64_t>(product >> 64);
+#else
+    auto leftHigh = low >> 32;
+    auto leftLow = low & 0xFFFFFFFF;
+    auto rightHigh = high >> 32;
+    auto rightLow = high & 0xFFFFFFFF;
+
+    auto highProduct = leftHigh * rightHigh;
+    auto middleLeft = leftHigh * rightLow;
+    auto middleRight = rightHigh * leftLow;
+    auto lowProduct = leftLow * rightLow;
+
+    auto sum = lowProduct + (middleLeft << 32);
+    auto carry = static_cast<std::uint64_t>(sum < lowProduct);
+
+    low = sum + (middleRight << 32);
+    carry += static_cast<std::uint64_t>(low < sum);
+    high = highProduct + (middleLeft >> 32) + (middleRight >> 32) + carry;
+#endif
+}
+
+inline std::uint64_t Dataplex::hash::detail::mix(std::uint64_t left, std::uint64_t right)
+{
+    multiply(left, right);
+
+    return left ^ right;
+}
+
+inline std::uint64_t Dataplex::hash::detail::read64(const std::uint8_t* data)
+{
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+
+    return value;
+}
+
+inline std::uint64_t Dataplex::hash::detail::read32(const std::uint8_t* data)
+{
+    std::uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+
+    return value;
+}
+
+inline std::uint64_t Dataplex::hash::detail::read_small(const std::uint8_t* data, std::size_t length)
+{
+    return (std::uint64_t(data[0]) << 16) | (std::uint64_t(data[length >> 1]) << 8) | data[length - 1];
+}
+
+inline void Dataplex::hash::detail::accumulate(std::uint64_t* accumulators, const std::uint8_t* data, const std::uint64_t* keys)
+{
+#if defined(__AVX2__)
+    for (std::size_t half = 0; half < 2; ++half)
+    {
+        auto accumulator = _mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators + 4 * half));
+        auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32 * half));
+        auto keyed = _mm256_xor_si256(input, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + 4 * half)));
+        auto product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+        auto swapped = _mm256_shuffle_epi32(input, _MM_SHUFFLE(1, 0, 3, 2));
+
+        accumulator = _mm256_add_epi64(accumulator, _mm256_add_epi64(product, swapped));
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(accumulators + 4 * half), accumulator);
+    }
+#else
+    for (std::size_t lane = 0; lane < 8; ++lane)
+    {
+        auto input = read64(data + 8 * lane);
+        auto keyed = input ^ keys[lane];
+
+        accumulators[lane ^ 1] += input;
+        accumulators[lane] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+    }
+#endif
+}
+
+inline void Dataplex::hash::detail::scramble(std::uint64_t* accumulators, const std::uint64_t* keys)
+{
+#if defined(__AVX2__)
+    auto prime = _mm256_set1_epi64x(static_cast<long long>(ScramblePrime));
+
+    for (std::size_t half = 0; half < 2; ++half)
+    {
+        auto accumulator = _mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators + 4 * half));
+
+        accumulator = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+        accumulator = _mm256_xor_si256(accumulator, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + 4 * half)));
+
+        auto low = _mm256_mul_epu32(accumulator, prime);
+        auto high = _mm256_mul_epu32(_mm256_srli_epi64(accumulator, 32), prime);
+
+        accumulator = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(accumulators + 4 * half), accumulator);
+    }
+#else
+    for (std::size_t lane = 0; lane < 8; ++lane)
+    {
+        auto accumulator = accumulators[lane];
+
+        accumulator ^= accumulator >> 47;
+        accumulator ^= keys[lane];
+
+        accumulators[lane] = accumulator * ScramblePrime;
+    }
+#endif
+}
+
+inline std::uint64_t Dataplex::hash::detail::hash_short(const std::uint8_t* data, std::size_t length, std::uint64_t seed)
+{
+    seed ^= mix(seed ^ Secret[0], Secret[1]);
+
+    std::uint64_t left = 0;
+    std::uint64_t right = 0;
+
+    if (length <= 16)
+    {
+        if (length >= 4)
+        {
+            auto offset = (length >> 3) << 2;
+
+            left = (read32(data) << 32) | read32(data + offset);
+            right = (read32(data + length - 4) << 32) | read32(data + length - 4 - offset);
+        }
+        else if (length > 0)
+        {
+            left = read_small(data, length);
+        }
+    }
+    else
+    {
+        auto remaining = length;
+
+        if (remaining > 48)
+        {
+            auto first = seed;
+            auto second = seed;
+
+            do
+            {
+                seed = mix(read64(data) ^ Secret[1], read64(data + 8) ^ seed);
+                first = mix(read64(data + 16) ^ Secret[2], read64(data + 24) ^ first);
+                second = mix(read64(data + 32) ^ Secret[3], read64(data + 40) ^ second);
+
+                data += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= first ^ second;
+        }
+
+        while (remaining > 16)
+        {
+            seed = mix(read64(data) ^ Secret[1], read64(data + 8) ^ seed);
+
+            data += 16;
+            remaining -= 16;
+        }
+
+        left = read64(data + remaining - 16);
+        right = read64(data + remaining - 8);
+    }
+
+    left ^= Secret[1];
+    right ^= seed;
+
+    multiply(left, right);
+
+    return mix(left ^ Secret[0] ^ length, right ^ Secret[1]);
+}
+
+inline std::uint64_t Dataplex::hash::detail::hash_long(const std::uint8_t* data, std::size_t length, std::uint64_t seed)
+{
+    alignas(32) std::uint64_t accumulators[8] =
+    {
+        0x3C6EF372FE94F82B, 0xBB67AE8584CAA73B, 0xA54FF53A5F1D36F1, 0x6A09E667F3BCC908,
+        0x510E527FADE682D1, 0x9B05688C2B3E6C1F, 0x1F83D9ABFB41BD6B, 0x5BE0CD19137E2179
+    };
+
+    std::uint64_t keys[8];
+
+    for (std::size_t lane = 0; lane < 8; ++lane)
+    {
+        keys[lane] = mix(seed ^ Secret[lane % 4], Secret[(lane + 1) % 4] + lane);
+    }
+
+    auto stripes = (length - 1) / StripeBytes;
+
+    for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+    {
+        accumulate(accumulators, data + stripe * StripeBytes, keys);
+
+        if ((stripe + 1) % StripesPerBlock == 0)
+        {
+            scramble(accumulators, keys);
+        }
+    }
+
+    auto merged = length * Secret[1];
+
+    for (std::size_t lane = 0; lane < 8; lane += 2)
+    {
+        merged = mix(accumulators[lane] ^ keys[lane], accumulators[lane + 1] ^ keys[lane + 1] ^ merged);
+    }
+
+    auto consumed = stripes * StripeBytes;
+
+    return hash_short(data + consumed, length - consumed, merged ^ seed);
+}
+
+inline std::uint64_t Dataplex::hash::seed()
+{
+    static const std::uint64_t value = []
+    {
+        std::random_device device;
+
+        auto entropy = (std::uint64_t(device()) << 32) ^ device();
+        auto time = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        auto address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&device));
+
+        return detail::mix(entropy ^ detail::Secret[0], time ^ address ^ detail::Secret[1]);
+    }();
+
+    return value;
+}
+
+inline std::uint64_t Dataplex::hash::mix64(std::uint64_t value)
+{
+    return mix64(value, seed());
+}
+
+inline std::uint64_t Dataplex::hash::mix64(std::uint64_t value, std::uint64_t seed)
+{
+    return detail::mix(value ^ detail::Secret[0], seed ^ detail::Secret[1]);
+}
+
+inline std::uint64_t Dataplex::hash::hash_bytes(const void* data, std::size_t length)
+{
+    return hash_bytes(data, length, seed());
+}
+
+inline std::uint64_t Dataplex::hash::hash_bytes(const void* data, std::size_t length, std::uint64_t seed)
+{
+    auto bytes = static_cast<const std::uint8_t*>(data);
+
+    return length <= detail::LongThreshold ? detail::hash_short(bytes, length, seed) : detail::hash_long(bytes, length, seed);
+}
+
+template<typename T>
+Dataplex::hash::Hash<T>::Hash() :
+    Hash(hash::seed())
+{
+}
+
+template<typename T>
+Dataplex::hash::Hash<T>::Hash(std::uint64_t seed) :
+    _seed(seed)
+{
+}
+
+template<typename T>
+std::size_t Dataplex::hash::Hash<T>::operator()(const T& value) const
+{
+    if constexpr (std::is_integral<T>::value || std::is_enum<T>::value)
+    {
+        return static_cast<std::size_t>(mix64(static_cast<std::uint64_t>(value), _seed));
+    }
+    else if constexpr (std::is_pointer<T>::value)
+    {
+        return static_cast<std::size_t>(mix64(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value)), _seed));
+    }
+    else if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+    {
+        auto normalized = value == T(0) ? T(0) : value;
+
+        return static_cast<std::size_t>(hash_bytes(&normalized, sizeof(normalized), _seed));
+    }
+    else
+    {
+        return static_cast<std::size_t>(mix64(static_cast<std::uint64_t>(std::hash<T>()(value)), _seed));
+    }
+}
+
+inline Dataplex::hash::Hash<std::string>::Hash() :
+    Hash(hash::seed())
+{
+}
+
+inline Dataplex::hash::Hash<std::string>::Hash(std::uint64_t seed) :
+    _seed(seed)
+{
+}
+
+inline std::size_t Dataplex::hash::Hash<std::string>::operator()(const std::string& value) const
+{
+    return static_cast<std::size_t>(hash_bytes(value.data(), value.size(), _seed));
+}
+
+inline std::size_t Dataplex::hash::Hash<std::string>::operator()(std::string_view value) const
+{
+    return static_cast<std::size_t>(hash_bytes(value.data(), value.size(), _seed));
+}
+
+inline std::size_t Dataplex::hash::Hash<std::string>::operator()(const char* value) const
+{
+    return (*this)(std::string_view(value));
+}
+
+inline Dataplex::hash::Hash<std::string_view>::Hash() :
+    Hash(hash::seed())
+{
+}
+
+inline Dataplex::hash::Hash<std::string_view>::Hash(std::uint64_t seed) :
+    _seed(seed)
+{
+}
+
+inline std::size_t Dataplex::hash::Hash<std::string_view>::operator()(std::string_view value) const
+{
+    return static_cast<std::size_t>(hash_bytes(value.data(), value.size(), _seed));
+}
@@ -7,50 +7,995 @@ http://inversepalindrome.com
 
 #pragma once
 
+#include "Hash.hpp"
+
+#include <tuple>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
 
 namespace Dataplex
 {
-    template<typename Key, typename Value>
+    namespace detail
+    {
+        template<typename Hasher, typename = void>
+        struct is_transparent : std::false_type
+        {
+        };
+
+        template<typename Hasher>
+        struct is_transparent<Hasher, std::void_t<typename Hasher::is_transparent>> : std::true_type
+        {
+        };
+
+        template<typename Key, typename K, typename Hasher>
+        using enable_lookup = std::enable_if_t<std::is_same<Key, K>::value || is_transparent<Hasher>::value>;
+    }
+
+    // In Resize::Incremental mode each insertion of a new key and each erase moves a few entries out
+    // of the old table, invalidating iterators and references. Lookups never move entries, and
+    // finish_resize() completes a pending migration at once.
+    template<typename Key, typename Value, typename Hasher = hash::Hash<Key>>
     class HashMap
     {
     public:
-        HashMap(const HashMap<Key, Value>& hashMap);
-        HashMap<Key, Value>& operator=(const HashMap <Key, Value>& hashMap);
-        HashMap(HashMap<Key, Value>&& hashMap);
-        HashMap<Key, Value>& operator=(HashMap<Key, Value>&& hashMap);
+        using Entry = std::pair<const Key, Value>;
+
+        enum class Resize
+        {
+            Immediate,
+            Incremental
+        };
+
+        HashMap();
+        explicit HashMap(Resize resize, const Hasher& hasher = Hasher());
+        HashMap(const HashMap<Key, Value, Hasher>& hashMap);
+        HashMap<Key, Value, Hasher>& operator=(const HashMap<Key, Value, Hasher>& hashMap);
+        HashMap(HashMap<Key, Value, Hasher>&& hashMap);
+        HashMap<Key, Value, Hasher>& operator=(HashMap<Key, Value, Hasher>&& hashMap);
+        HashMap(std::initializer_list<Entry> list);
 
         ~HashMap();
 
+        class Iterator;
+        class ConstIterator;
+
+        Iterator begin();
+        ConstIterator begin() const;
+
+        Iterator end();
+        ConstIterator end() const;
+
+        Value& operator[](const Key& key);
+        Value& operator[](Key&& key);
+
+        Value& at(const Key& key);
+        const Value& at(const Key& key) const;
+
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        Value& at(const K& key);
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        const Value& at(const K& key) const;
+
+        Iterator find(const Key& key);
+        ConstIterator find(const Key& key) const;
+
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        Iterator find(const K& key);
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        ConstIterator find(const K& key) const;
+
+        bool contains(const Key& key) const;
+
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        bool contains(const K& key) const;
+
+        bool insert(const Key& key, const Value& value);
+        bool insert(Key&& key, Value&& value);
+
+        template<typename K, typename... Args>
+        bool emplace(K&& key, Args&&... args);
+
+        bool erase(const Key& key);
+
+        template<typename K, typename = detail::enable_lookup<Key, K, Hasher>>
+        bool erase(const K& key);
+
+        void reserve(std::size_t size);
+        void finish_resize();
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_resizing() const;
+
+    private:
+        struct Table
+        {
+            Entry* entries = nullptr;
+            std::uint8_t* states = nullptr;
+            std::size_t capacity = 0;
+            std::size_t size = 0;
+            std::size_t deleted = 0;
+        };
+
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = Entry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Entry*;
+            using reference = Entry&;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator();
+            Iterator(Table* tables, std::size_t table, std::size_t slot);
+
+            Entry& operator*() const;
+            Entry* operator->() const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            bool operator==(const Iterator& iterator) const;
+            bool operator!=(const Iterator& iterator) const;
+
+        private:
+            Table* _tables;
+            std::size_t _table;
+            std::size_t _slot;
+
+            void skip_free_slots();
+        };
+
+        class ConstIterator
+        {
+        public:
+            using value_type = Entry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Entry*;
+            using reference = const Entry&;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(const Table* tables, std::size_t table, std::size_t slot);
+
+            const Entry& operator*() const;
+            const Entry* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const Table* _tables;
+            std::size_t _table;
+            std::size_t _slot;
+
+            void skip_free_slots();
+        };
+
     private:
+        static constexpr std::uint8_t Empty = 0;
+        static constexpr std::uint8_t Full = 1;
+        static constexpr std::uint8_t Deleted = 2;
+
+        static constexpr std::size_t InitialCapacity = 16;
+        static constexpr std::size_t MigrationStep = 16;
+        static constexpr std::size_t NotFound = static_cast<std::size_t>(-1);
+
+        Table _tables[2];
+        std::size_t _migrated;
+        Resize _resize;
+        Hasher _hasher;
+
+        template<typename K>
+        std::size_t hash(const K& key) const;
+
+        static Table allocate_table(std::size_t capacity);
+        static void release_table(Table& table);
+
+        template<typename K>
+        static std::size_t find_slot(const Table& table, const K& key, std::size_t hash);
+        static std::size_t free_slot(const Table& table, std::size_t hash);
+
+        template<typename K>
+        Entry* find_entry(const K& key, std::size_t hash);
+        template<typename K>
+        const Entry* find_entry(const K& key, std::size_t hash) const;
+
+        std::size_t move_entry(Table& from, std::size_t slot, Table& to);
+
+        template<typename K, typename... Args>
+        std::pair<Entry*, bool> emplace_entry(K&& key, Args&&... args);
+
+        void reserve_slot();
+        void rehash(std::size_t capacity);
+        void migrate(std::size_t slots);
+
+        void swap(HashMap<Key, Value, Hasher>& hashMap);
     };
 }
 
-template<typename Key, typename Value>
-Dataplex::HashMap<Key, Value>::HashMap(const HashMap<Key, Value>& hashMap)
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::HashMap() :
+    HashMap(Resize::Immediate)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::HashMap(Resize resize, const Hasher& hasher) :
+    _tables(),
+    _migrated(0),
+    _resize(resize),
+    _hasher(hasher)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::HashMap(const HashMap<Key, Value, Hasher>& hashMap) :
+    HashMap(hashMap._resize, hashMap._hasher)
 {
+    reserve(hashMap.size());
 
+    for (const auto& entry : hashMap)
+    {
+        emplace(entry.first, entry.second);
+    }
 }
 
-template<typename Key, typename Value>
-Dataplex::HashMap<Key, Value>& Dataplex::HashMap<Key, Value>::operator=(const HashMap<Key, Value>& hashMap)
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>& Dataplex::HashMap<Key, Value, Hasher>::operator=(const HashMap<Key, Value, Hasher>& hashMap)
 {
+    HashMap<Key, Value, Hasher> temp(hashMap);
+    swap(temp);
+
     return *this;
 }
 
-template<typename Key, typename Value>
-Dataplex::HashMap<Key, Value>::HashMap(HashMap<Key, Value>&& hashMap)
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::HashMap(HashMap<Key, Value, Hasher>&& hashMap) :
+    HashMap(hashMap._resize, hashMap._hasher)
 {
-    
+    swap(hashMap);
 }
 
-template<typename Key, typename Value>
-Dataplex::HashMap<Key, Value>& Dataplex::HashMap<Key, Value>::operator=(HashMap<Key, Value>&& hashMap)
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>& Dataplex::HashMap<Key, Value, Hasher>::operator=(HashMap<Key, Value, Hasher>&& hashMap)
 {
+    swap(hashMap);
+
     return *this;
 }
 
-template<typename Key, typename Value>
-Dataplex::HashMap<Key, Value>::~HashMap()
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::HashMap(std::initializer_list<Entry> list) :
+    HashMap()
+{
+    reserve(list.size());
+
+    for (const auto& entry : list)
+    {
+        emplace(entry.first, entry.second);
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::~HashMap()
+{
+    release_table(_tables[0]);
+    release_table(_tables[1]);
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator Dataplex::HashMap<Key, Value, Hasher>::begin()
+{
+    return Iterator(_tables, 0, 0);
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator Dataplex::HashMap<Key, Value, Hasher>::begin() const
+{
+    return ConstIterator(_tables, 0, 0);
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator Dataplex::HashMap<Key, Value, Hasher>::end()
+{
+    return Iterator(_tables, 1, _tables[1].capacity);
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator Dataplex::HashMap<Key, Value, Hasher>::end() const
+{
+    return ConstIterator(_tables, 1, _tables[1].capacity);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value& Dataplex::HashMap<Key, Value, Hasher>::operator[](const Key& key)
+{
+    return emplace_entry(key).first->second;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value& Dataplex::HashMap<Key, Value, Hasher>::operator[](Key&& key)
+{
+    return emplace_entry(std::move(key)).first->second;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value& Dataplex::HashMap<Key, Value, Hasher>::at(const Key& key)
+{
+    return at<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+Value& Dataplex::HashMap<Key, Value, Hasher>::at(const K& key)
+{
+    auto entry = find_entry(key, hash(key));
+
+    if (!entry)
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return entry->second;
+}
+
+template<typename Key, typename Value, typename Hasher>
+const Value& Dataplex::HashMap<Key, Value, Hasher>::at(const Key& key) const
+{
+    return at<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+const Value& Dataplex::HashMap<Key, Value, Hasher>::at(const K& key) const
+{
+    auto entry = find_entry(key, hash(key));
+
+    if (!entry)
+    {
+        throw std::out_of_range("Key not found!");
+    }
+
+    return entry->second;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator Dataplex::HashMap<Key, Value, Hasher>::find(const Key& key)
+{
+    return find<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator Dataplex::HashMap<Key, Value, Hasher>::find(const K& key)
+{
+    auto hashValue = hash(key);
+
+    for (std::size_t table = 0; table < 2; ++table)
+    {
+        auto slot = find_slot(_tables[table], key, hashValue);
+
+        if (slot != NotFound)
+        {
+            return Iterator(_tables, table, slot);
+        }
+    }
+
+    return end();
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator Dataplex::HashMap<Key, Value, Hasher>::find(const Key& key) const
+{
+    return find<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator Dataplex::HashMap<Key, Value, Hasher>::find(const K& key) const
+{
+    auto hashValue = hash(key);
+
+    for (std::size_t table = 0; table < 2; ++table)
+    {
+        auto slot = find_slot(_tables[table], key, hashValue);
+
+        if (slot != NotFound)
+        {
+            return ConstIterator(_tables, table, slot);
+        }
+    }
+
+    return end();
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::contains(const Key& key) const
+{
+    return contains<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+bool Dataplex::HashMap<Key, Value, Hasher>::contains(const K& key) const
+{
+    return find_entry(key, hash(key)) != nullptr;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::insert(const Key& key, const Value& value)
+{
+    return emplace(key, value);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::insert(Key&& key, Value&& value)
+{
+    return emplace(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename... Args>
+bool Dataplex::HashMap<Key, Value, Hasher>::emplace(K&& key, Args&&... args)
+{
+    return emplace_entry(std::forward<K>(key), std::forward<Args>(args)...).second;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::erase(const Key& key)
+{
+    return erase<Key>(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename>
+bool Dataplex::HashMap<Key, Value, Hasher>::erase(const K& key)
+{
+    migrate(MigrationStep);
+
+    auto hashValue = hash(key);
+
+    for (auto& table : _tables)
+    {
+        auto slot = find_slot(table, key, hashValue);
+
+        if (slot != NotFound)
+        {
+            table.entries[slot].~Entry();
+            table.states[slot] = Deleted;
+
+            --table.size;
+            ++table.deleted;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::reserve(std::size_t size)
+{
+    finish_resize();
+
+    auto capacity = InitialCapacity;
+
+    while (capacity * 3 < size * 4 + 4)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > _tables[0].capacity)
+    {
+        rehash(capacity);
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::finish_resize()
+{
+    migrate(_tables[1].capacity);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::clear()
+{
+    release_table(_tables[1]);
+    _migrated = 0;
+
+    auto& table = _tables[0];
+
+    for (std::size_t slot = 0; slot < table.capacity; ++slot)
+    {
+        if (table.states[slot] == Full)
+        {
+            table.entries[slot].~Entry();
+        }
+
+        table.states[slot] = Empty;
+    }
+
+    table.size = 0;
+    table.deleted = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::size() const
 {
+    return _tables[0].size + _tables[1].size;
+}
 
-}
\ No newline at end of file
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::capacity() const
+{
+    return _tables[0].capacity;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::is_resizing() const
+{
+    return _tables[1].capacity > 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::hash(const K& key) const
+{
+    return static_cast<std::size_t>(_hasher(key));
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Table Dataplex::HashMap<Key, Value, Hasher>::allocate_table(std::size_t capacity)
+{
+    Table table;
+
+    table.entries = std::allocator<Entry>().allocate(capacity);
+
+    try
+    {
+        table.states = new std::uint8_t[capacity]();
+    }
+    catch (...)
+    {
+        std::allocator<Entry>().deallocate(table.entries, capacity);
+
+        throw;
+    }
+
+    table.capacity = capacity;
+
+    return table;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::release_table(Table& table)
+{
+    for (std::size_t slot = 0; slot < table.capacity; ++slot)
+    {
+        if (table.states[slot] == Full)
+        {
+            table.entries[slot].~Entry();
+        }
+    }
+
+    if (table.capacity > 0)
+    {
+        std::allocator<Entry>().deallocate(table.entries, table.capacity);
+    }
+
+    delete[] table.states;
+
+    table = Table();
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::find_slot(const Table& table, const K& key, std::size_t hash)
+{
+    if (table.size == 0)
+    {
+        return NotFound;
+    }
+
+    auto mask = table.capacity - 1;
+
+    for (auto slot = hash & mask; ; slot = (slot + 1) & mask)
+    {
+        if (table.states[slot] == Empty)
+        {
+            return NotFound;
+        }
+        else if (table.states[slot] == Full && table.entries[slot].first == key)
+        {
+            return slot;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::free_slot(const Table& table, std::size_t hash)
+{
+    auto mask = table.capacity - 1;
+    auto slot = hash & mask;
+
+    while (table.states[slot] == Full)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K>
+typename Dataplex::HashMap<Key, Value, Hasher>::Entry* Dataplex::HashMap<Key, Value, Hasher>::find_entry(const K& key, std::size_t hash)
+{
+    for (auto& table : _tables)
+    {
+        auto slot = find_slot(table, key, hash);
+
+        if (slot != NotFound)
+        {
+            return table.entries + slot;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K>
+const typename Dataplex::HashMap<Key, Value, Hasher>::Entry* Dataplex::HashMap<Key, Value, Hasher>::find_entry(const K& key, std::size_t hash) const
+{
+    for (const auto& table : _tables)
+    {
+        auto slot = find_slot(table, key, hash);
+
+        if (slot != NotFound)
+        {
+            return table.entries + slot;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::HashMap<Key, Value, Hasher>::move_entry(Table& from, std::size_t slot, Table& to)
+{
+    auto& entry = from.entries[slot];
+    auto target = free_slot(to, hash(entry.first));
+
+    ::new (static_cast<void*>(to.entries + target)) Entry(std::move(const_cast<Key&>(entry.first)), std::move(entry.second));
+
+    if (to.states[target] == Deleted)
+    {
+        --to.deleted;
+    }
+
+    to.states[target] = Full;
+    ++to.size;
+
+    entry.~Entry();
+    from.states[slot] = Deleted;
+
+    --from.size;
+    ++from.deleted;
+
+    return target;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename... Args>
+std::pair<typename Dataplex::HashMap<Key, Value, Hasher>::Entry*, bool> Dataplex::HashMap<Key, Value, Hasher>::emplace_entry(K&& key, Args&&... args)
+{
+    auto hashValue = hash(key);
+
+    if (auto entry = find_entry(key, hashValue))
+    {
+        return { entry, false };
+    }
+
+    migrate(MigrationStep);
+    reserve_slot();
+
+    auto& table = _tables[0];
+    auto slot = free_slot(table, hashValue);
+
+    ::new (static_cast<void*>(table.entries + slot)) Entry(std::piecewise_construct,
+        std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+    if (table.states[slot] == Deleted)
+    {
+        --table.deleted;
+    }
+
+    table.states[slot] = Full;
+    ++table.size;
+
+    return { table.entries + slot, true };
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::reserve_slot()
+{
+    auto& table = _tables[0];
+
+    if ((table.size + table.deleted + _tables[1].size + 1) * 4 <= table.capacity * 3)
+    {
+        return;
+    }
+
+    finish_resize();
+
+    if ((table.size + table.deleted + 1) * 4 <= table.capacity * 3)
+    {
+        return;
+    }
+
+    auto capacity = std::max(table.capacity, InitialCapacity);
+
+    if ((table.size + 1) * 2 > capacity)
+    {
+        capacity *= 2;
+    }
+
+    if (_resize == Resize::Immediate || table.size == 0)
+    {
+        rehash(capacity);
+    }
+    else
+    {
+        _tables[1] = _tables[0];
+        _tables[0] = allocate_table(capacity);
+        _migrated = 0;
+
+        migrate(MigrationStep);
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::rehash(std::size_t capacity)
+{
+    auto table = allocate_table(capacity);
+
+    for (std::size_t slot = 0; slot < _tables[0].capacity; ++slot)
+    {
+        if (_tables[0].states[slot] == Full)
+        {
+            move_entry(_tables[0], slot, table);
+        }
+    }
+
+    release_table(_tables[0]);
+
+    _tables[0] = table;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::migrate(std::size_t slots)
+{
+    if (!is_resizing())
+    {
+        return;
+    }
+
+    auto& oldTable = _tables[1];
+    auto last = std::min(_migrated + slots, oldTable.capacity);
+
+    for (; _migrated < last && oldTable.size > 0; ++_migrated)
+    {
+        if (oldTable.states[_migrated] == Full)
+        {
+            move_entry(oldTable, _migrated, _tables[0]);
+        }
+    }
+
+    if (oldTable.size == 0)
+    {
+        release_table(oldTable);
+        _migrated = 0;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::swap(HashMap<Key, Value, Hasher>& hashMap)
+{
+    using std::swap;
+
+    swap(_tables[0], hashMap._tables[0]);
+    swap(_tables[1], hashMap._tables[1]);
+    swap(_migrated, hashMap._migrated);
+    swap(_resize, hashMap._resize);
+    swap(_hasher, hashMap._hasher);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::Iterator::Iterator() :
+    _tables(nullptr),
+    _table(1),
+    _slot(0)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::Iterator::Iterator(Table* tables, std::size_t table, std::size_t slot) :
+    _tables(tables),
+    _table(table),
+    _slot(slot)
+{
+    skip_free_slots();
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Entry& Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator*() const
+{
+    return _tables[_table].entries[_slot];
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Entry* Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator& Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator++()
+{
+    ++_slot;
+    skip_free_slots();
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::Iterator Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator==(const Iterator& iterator) const
+{
+    return _table == iterator._table && _slot == iterator._slot;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::Iterator::operator!=(const Iterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::Iterator::skip_free_slots()
+{
+    while (_tables)
+    {
+        const auto& table = _tables[_table];
+
+        for (; _slot < table.capacity; ++_slot)
+        {
+            if (table.states[_slot] == Full)
+            {
+                return;
+            }
+        }
+
+        if (_table == 1)
+        {
+            return;
+        }
+
+        _table = 1;
+        _slot = 0;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::ConstIterator() :
+    _tables(nullptr),
+    _table(1),
+    _slot(0)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::ConstIterator(const Table* tables, std::size_t table, std::size_t slot) :
+    _tables(tables),
+    _table(table),
+    _slot(slot)
+{
+    skip_free_slots();
+}
+
+template<typename Key, typename Value, typename Hasher>
+const typename Dataplex::HashMap<Key, Value, Hasher>::Entry& Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator*() const
+{
+    return _tables[_table].entries[_slot];
+}
+
+template<typename Key, typename Value, typename Hasher>
+const typename Dataplex::HashMap<Key, Value, Hasher>::Entry* Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator& Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator++()
+{
+    ++_slot;
+    skip_free_slots();
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::HashMap<Key, Value, Hasher>::ConstIterator Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _table == iterator._table && _slot == iterator._slot;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::HashMap<Key, Value, Hasher>::ConstIterator::skip_free_slots()
+{
+    while (_tables)
+    {
+        const auto& table = _tables[_table];
+
+        for (; _slot < table.capacity; ++_slot)
+        {
+            if (table.states[_slot] == Full)
+            {
+                return;
+            }
+        }
+
+        if (_table == 1)
+        {
+            return;
+        }
+
+        _table = 1;
+        _slot = 0;
+    }
+}
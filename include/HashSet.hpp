@@ -7,50 +7,308 @@ http://inversepalindrome.com
 
 #pragma once
 
+#include "Hash.hpp"
+#include "HashMap.hpp"
+#include "Utility.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <initializer_list>
+
 
 namespace Dataplex
 {
-    template<typename T>
+    template<typename T, typename Hasher = hash::Hash<T>>
     class HashSet
     {
+    private:
+        using Map = HashMap<T, detail::EmptyValue, Hasher>;
+
     public:
-        HashSet(const HashSet<T>& hashSet);
-        HashSet<T>& operator=(const HashSet<T>& hashSet);
-        HashSet(HashSet<T>&& hashSet);
-        HashSet<T>& operator==(HashSet<T>&& hashSet);
+        using Resize = typename Map::Resize;
+
+        HashSet();
+        explicit HashSet(Resize resize, const Hasher& hasher = Hasher());
+        HashSet(const HashSet<T, Hasher>& hashSet);
+        HashSet<T, Hasher>& operator=(const HashSet<T, Hasher>& hashSet);
+        HashSet(HashSet<T, Hasher>&& hashSet);
+        HashSet<T, Hasher>& operator=(HashSet<T, Hasher>&& hashSet);
+        HashSet(std::initializer_list<T> list);
 
         ~HashSet();
 
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        ConstIterator find(const T& value) const;
+        bool contains(const T& value) const;
+
+        template<typename K, typename = detail::enable_lookup<T, K, Hasher>>
+        ConstIterator find(const K& value) const;
+        template<typename K, typename = detail::enable_lookup<T, K, Hasher>>
+        bool contains(const K& value) const;
+
+        bool insert(const T& value);
+        bool insert(T&& value);
+        bool erase(const T& value);
+
+        template<typename K, typename = detail::enable_lookup<T, K, Hasher>>
+        bool erase(const K& value);
+
+        void reserve(std::size_t size);
+        void finish_resize();
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_resizing() const;
+
     private:
+        Map _map;
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            explicit ConstIterator(typename Map::ConstIterator iterator);
+
+            const T& operator*() const;
+            const T* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            typename Map::ConstIterator _iterator;
+        };
     };
 }
 
-template<typename T>
-Dataplex::HashSet<T>::HashSet(const HashSet<T>& hashSet)
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::HashSet() :
+    _map()
+{
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::HashSet(Resize resize, const Hasher& hasher) :
+    _map(resize, hasher)
+{
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::HashSet(const HashSet<T, Hasher>& hashSet) :
+    _map(hashSet._map)
+{
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>& Dataplex::HashSet<T, Hasher>::operator=(const HashSet<T, Hasher>& hashSet)
+{
+    _map = hashSet._map;
+
+    return *this;
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::HashSet(HashSet<T, Hasher>&& hashSet) :
+    _map(std::move(hashSet._map))
+{
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>& Dataplex::HashSet<T, Hasher>::operator=(HashSet<T, Hasher>&& hashSet)
+{
+    _map = std::move(hashSet._map);
+
+    return *this;
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::HashSet(std::initializer_list<T> list) :
+    HashSet()
+{
+    reserve(list.size());
+
+    for (const auto& value : list)
+    {
+        insert(value);
+    }
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::~HashSet()
+{
+}
+
+template<typename T, typename Hasher>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator Dataplex::HashSet<T, Hasher>::begin() const
+{
+    return ConstIterator(_map.begin());
+}
+
+template<typename T, typename Hasher>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator Dataplex::HashSet<T, Hasher>::end() const
+{
+    return ConstIterator(_map.end());
+}
+
+template<typename T, typename Hasher>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator Dataplex::HashSet<T, Hasher>::find(const T& value) const
+{
+    return ConstIterator(_map.find(value));
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::contains(const T& value) const
+{
+    return _map.contains(value);
+}
+
+template<typename T, typename Hasher>
+template<typename K, typename>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator Dataplex::HashSet<T, Hasher>::find(const K& value) const
+{
+    return ConstIterator(_map.find(value));
+}
+
+template<typename T, typename Hasher>
+template<typename K, typename>
+bool Dataplex::HashSet<T, Hasher>::contains(const K& value) const
+{
+    return _map.contains(value);
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::insert(const T& value)
+{
+    return _map.emplace(value);
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::insert(T&& value)
+{
+    return _map.emplace(std::move(value));
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::erase(const T& value)
+{
+    return _map.erase(value);
+}
+
+template<typename T, typename Hasher>
+template<typename K, typename>
+bool Dataplex::HashSet<T, Hasher>::erase(const K& value)
 {
+    return _map.erase(value);
+}
 
+template<typename T, typename Hasher>
+void Dataplex::HashSet<T, Hasher>::reserve(std::size_t size)
+{
+    _map.reserve(size);
 }
 
-template<typename T>
-Dataplex::HashSet<T>& Dataplex::HashSet<T>::operator=(const HashSet<T>& hashSet)
+template<typename T, typename Hasher>
+void Dataplex::HashSet<T, Hasher>::finish_resize()
 {
-    return *this
+    _map.finish_resize();
 }
 
-template<typename T>
-Dataplex::HashSet<T>::HashSet(HashSet<T>&& hashSet)
+template<typename T, typename Hasher>
+void Dataplex::HashSet<T, Hasher>::clear()
 {
+    _map.clear();
+}
 
+template<typename T, typename Hasher>
+std::size_t Dataplex::HashSet<T, Hasher>::size() const
+{
+    return _map.size();
 }
 
-template<typename T>
-Dataplex::HashSet<T>& Dataplex::HashSet<T>::operator==(HashSet<T>&& hashSet)
+template<typename T, typename Hasher>
+std::size_t Dataplex::HashSet<T, Hasher>::capacity() const
 {
+    return _map.capacity();
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::is_empty() const
+{
+    return _map.is_empty();
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::is_resizing() const
+{
+    return _map.is_resizing();
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::ConstIterator::ConstIterator() :
+    _iterator()
+{
+}
+
+template<typename T, typename Hasher>
+Dataplex::HashSet<T, Hasher>::ConstIterator::ConstIterator(typename Map::ConstIterator iterator) :
+    _iterator(iterator)
+{
+}
+
+template<typename T, typename Hasher>
+const T& Dataplex::HashSet<T, Hasher>::ConstIterator::operator*() const
+{
+    return _iterator->first;
+}
+
+template<typename T, typename Hasher>
+const T* Dataplex::HashSet<T, Hasher>::ConstIterator::operator->() const
+{
+    return &_iterator->first;
+}
+
+template<typename T, typename Hasher>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator& Dataplex::HashSet<T, Hasher>::ConstIterator::operator++()
+{
+    ++_iterator;
+
     return *this;
 }
 
-template<typename T>
-Dataplex::HashSet<T>::~HashSet()
+template<typename T, typename Hasher>
+typename Dataplex::HashSet<T, Hasher>::ConstIterator Dataplex::HashSet<T, Hasher>::ConstIterator::operator++(int)
 {
+    auto iterator = *this;
+    ++*this;
 
-}
\ No newline at end of file
+    return iterator;
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _iterator == iterator._iterator;
+}
+
+template<typename T, typename Hasher>
+bool Dataplex::HashSet<T, Hasher>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _iterator != iterator._iterator;
+}
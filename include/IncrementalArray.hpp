@@ -0,0 +1,820 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - IncrementalArray.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename T>
+    class IncrementalArray
+    {
+    public:
+        IncrementalArray();
+        IncrementalArray(const IncrementalArray<T>& array);
+        IncrementalArray<T>& operator=(const IncrementalArray<T>& array);
+        IncrementalArray(IncrementalArray<T>&& array);
+        IncrementalArray<T>& operator=(IncrementalArray<T>&& array);
+        explicit IncrementalArray(std::size_t capacity);
+        IncrementalArray(std::initializer_list<T> list);
+
+        ~IncrementalArray();
+
+        class Iterator;
+        class ConstIterator;
+
+        Iterator begin();
+        ConstIterator begin() const;
+
+        Iterator end();
+        ConstIterator end() const;
+
+        std::reverse_iterator<Iterator> rbegin();
+        std::reverse_iterator<ConstIterator> rbegin() const;
+
+        std::reverse_iterator<Iterator> rend();
+        std::reverse_iterator<ConstIterator> rend() const;
+
+        T& operator[](std::size_t pos);
+        const T& operator[](std::size_t pos) const;
+
+        T& head();
+        const T& head() const;
+
+        T& tail();
+        const T& tail() const;
+
+        void push_back(const T& data);
+        void push_back(T&& data);
+
+        template<typename... Args>
+        void emplace_back(Args&&... args);
+
+        void pop_back();
+
+        void reserve(std::size_t capacity);
+        void finish_resize();
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_resizing() const;
+
+        class Iterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+            using iterator_category = std::random_access_iterator_tag;
+
+            Iterator();
+            Iterator(IncrementalArray<T>* array, std::size_t index);
+
+            T& operator*() const;
+            T* operator->() const;
+            T& operator[](difference_type offset) const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            Iterator& operator--();
+            Iterator operator--(int);
+
+            Iterator& operator+=(difference_type offset);
+            Iterator& operator-=(difference_type offset);
+
+            Iterator operator+(difference_type offset) const;
+            Iterator operator-(difference_type offset) const;
+            difference_type operator-(const Iterator& iterator) const;
+
+            bool operator==(const Iterator& iterator) const;
+            bool operator!=(const Iterator& iterator) const;
+            bool operator<(const Iterator& iterator) const;
+            bool operator>(const Iterator& iterator) const;
+            bool operator<=(const Iterator& iterator) const;
+            bool operator>=(const Iterator& iterator) const;
+
+        private:
+            IncrementalArray<T>* _array;
+            std::size_t _index;
+        };
+
+        class ConstIterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+            using iterator_category = std::random_access_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(const IncrementalArray<T>* array, std::size_t index);
+
+            const T& operator*() const;
+            const T* operator->() const;
+            const T& operator[](difference_type offset) const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            ConstIterator& operator--();
+            ConstIterator operator--(int);
+
+            ConstIterator& operator+=(difference_type offset);
+            ConstIterator& operator-=(difference_type offset);
+
+            ConstIterator operator+(difference_type offset) const;
+            ConstIterator operator-(difference_type offset) const;
+            difference_type operator-(const ConstIterator& iterator) const;
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+            bool operator<(const ConstIterator& iterator) const;
+            bool operator>(const ConstIterator& iterator) const;
+            bool operator<=(const ConstIterator& iterator) const;
+            bool operator>=(const ConstIterator& iterator) const;
+
+        private:
+            const IncrementalArray<T>* _array;
+            std::size_t _index;
+        };
+
+    private:
+        static constexpr std::size_t InitialCapacity = 16;
+        static constexpr std::size_t MigrationStep = 4;
+
+        std::size_t _size;
+        std::size_t _capacity;
+        T* _array;
+        T* _oldArray;
+        std::size_t _oldSize;
+        std::size_t _oldCapacity;
+        std::size_t _migrated;
+
+        T* element(std::size_t pos) const;
+
+        void migrate(std::size_t count);
+        void release_old_array();
+
+        void swap(IncrementalArray<T>& array);
+    };
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::IncrementalArray() :
+    _size(0),
+    _capacity(0),
+    _array(nullptr),
+    _oldArray(nullptr),
+    _oldSize(0),
+    _oldCapacity(0),
+    _migrated(0)
+{
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::IncrementalArray(const IncrementalArray<T>& array) :
+    IncrementalArray(array.size())
+{
+    for (const auto& data : array)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>& Dataplex::IncrementalArray<T>::operator=(const IncrementalArray<T>& array)
+{
+    IncrementalArray<T> temp(array);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::IncrementalArray(IncrementalArray<T>&& array) :
+    IncrementalArray()
+{
+    swap(array);
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>& Dataplex::IncrementalArray<T>::operator=(IncrementalArray<T>&& array)
+{
+    swap(array);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::IncrementalArray(std::size_t capacity) :
+    IncrementalArray()
+{
+    reserve(capacity);
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::IncrementalArray(std::initializer_list<T> list) :
+    IncrementalArray(list.size())
+{
+    for (const auto& data : list)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::~IncrementalArray()
+{
+    clear();
+
+    if (_array)
+    {
+        std::allocator<T>().deallocate(_array, _capacity);
+    }
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::begin()
+{
+    return Iterator(this, 0);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::end()
+{
+    return Iterator(this, _size);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::end() const
+{
+    return ConstIterator(this, _size);
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::IncrementalArray<T>::Iterator> Dataplex::IncrementalArray<T>::rbegin()
+{
+    return std::make_reverse_iterator(end());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::IncrementalArray<T>::ConstIterator> Dataplex::IncrementalArray<T>::rbegin() const
+{
+    return std::make_reverse_iterator(end());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::IncrementalArray<T>::Iterator> Dataplex::IncrementalArray<T>::rend()
+{
+    return std::make_reverse_iterator(begin());
+}
+
+template<typename T>
+std::reverse_iterator<typename Dataplex::IncrementalArray<T>::ConstIterator> Dataplex::IncrementalArray<T>::rend() const
+{
+    return std::make_reverse_iterator(begin());
+}
+
+template<typename T>
+T& Dataplex::IncrementalArray<T>::operator[](std::size_t pos)
+{
+    return *element(pos);
+}
+
+template<typename T>
+const T& Dataplex::IncrementalArray<T>::operator[](std::size_t pos) const
+{
+    return *element(pos);
+}
+
+template<typename T>
+T& Dataplex::IncrementalArray<T>::head()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return *element(0);
+}
+
+template<typename T>
+const T& Dataplex::IncrementalArray<T>::head() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return *element(0);
+}
+
+template<typename T>
+T& Dataplex::IncrementalArray<T>::tail()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return *element(_size - 1);
+}
+
+template<typename T>
+const T& Dataplex::IncrementalArray<T>::tail() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return *element(_size - 1);
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::push_back(const T& data)
+{
+    emplace_back(data);
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::push_back(T&& data)
+{
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::IncrementalArray<T>::emplace_back(Args&&... args)
+{
+    if (_size == _capacity)
+    {
+        finish_resize();
+
+        auto capacity = std::max(_capacity * 2, InitialCapacity);
+        auto array = std::allocator<T>().allocate(capacity);
+
+        if (_size == 0)
+        {
+            if (_array)
+            {
+                std::allocator<T>().deallocate(_array, _capacity);
+            }
+        }
+        else
+        {
+            _oldArray = _array;
+            _oldSize = _size;
+            _oldCapacity = _capacity;
+            _migrated = 0;
+        }
+
+        _array = array;
+        _capacity = capacity;
+    }
+
+    ::new (static_cast<void*>(_array + _size)) T(std::forward<Args>(args)...);
+    ++_size;
+
+    migrate(MigrationStep);
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::pop_back()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop back empty array!");
+    }
+
+    element(--_size)->~T();
+
+    if (_size < _oldSize)
+    {
+        _oldSize = _size;
+        _migrated = std::min(_migrated, _size);
+    }
+
+    migrate(MigrationStep);
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::reserve(std::size_t capacity)
+{
+    finish_resize();
+
+    if (capacity <= _capacity)
+    {
+        return;
+    }
+
+    auto array = std::allocator<T>().allocate(capacity);
+
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+        ::new (static_cast<void*>(array + i)) T(std::move(_array[i]));
+        _array[i].~T();
+    }
+
+    if (_array)
+    {
+        std::allocator<T>().deallocate(_array, _capacity);
+    }
+
+    _array = array;
+    _capacity = capacity;
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::finish_resize()
+{
+    migrate(_oldSize);
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::clear()
+{
+    while (_size > 0)
+    {
+        element(--_size)->~T();
+    }
+
+    release_old_array();
+}
+
+template<typename T>
+std::size_t Dataplex::IncrementalArray<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+std::size_t Dataplex::IncrementalArray<T>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::is_resizing() const
+{
+    return _oldArray != nullptr;
+}
+
+template<typename T>
+T* Dataplex::IncrementalArray<T>::element(std::size_t pos) const
+{
+    return pos < _migrated || pos >= _oldSize ? _array + pos : _oldArray + pos;
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::migrate(std::size_t count)
+{
+    if (!is_resizing())
+    {
+        return;
+    }
+
+    auto last = std::min(_migrated + count, _oldSize);
+
+    for (; _migrated < last; ++_migrated)
+    {
+        ::new (static_cast<void*>(_array + _migrated)) T(std::move(_oldArray[_migrated]));
+        _oldArray[_migrated].~T();
+    }
+
+    if (_migrated == _oldSize)
+    {
+        release_old_array();
+    }
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::release_old_array()
+{
+    if (_oldArray)
+    {
+        std::allocator<T>().deallocate(_oldArray, _oldCapacity);
+    }
+
+    _oldArray = nullptr;
+    _oldSize = 0;
+    _oldCapacity = 0;
+    _migrated = 0;
+}
+
+template<typename T>
+void Dataplex::IncrementalArray<T>::swap(IncrementalArray<T>& array)
+{
+    using std::swap;
+
+    swap(_size, array._size);
+    swap(_capacity, array._capacity);
+    swap(_array, array._array);
+    swap(_oldArray, array._oldArray);
+    swap(_oldSize, array._oldSize);
+    swap(_oldCapacity, array._oldCapacity);
+    swap(_migrated, array._migrated);
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::Iterator::Iterator() :
+    _array(nullptr),
+    _index(0)
+{
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::Iterator::Iterator(IncrementalArray<T>* array, std::size_t index) :
+    _array(array),
+    _index(index)
+{
+}
+
+template<typename T>
+T& Dataplex::IncrementalArray<T>::Iterator::operator*() const
+{
+    return (*_array)[_index];
+}
+
+template<typename T>
+T* Dataplex::IncrementalArray<T>::Iterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename T>
+T& Dataplex::IncrementalArray<T>::Iterator::operator[](difference_type offset) const
+{
+    return *(*this + offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator& Dataplex::IncrementalArray<T>::Iterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::Iterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator& Dataplex::IncrementalArray<T>::Iterator::operator--()
+{
+    --_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::Iterator::operator--(int)
+{
+    auto iterator = *this;
+    --*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator& Dataplex::IncrementalArray<T>::Iterator::operator+=(difference_type offset)
+{
+    _index += offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator& Dataplex::IncrementalArray<T>::Iterator::operator-=(difference_type offset)
+{
+    _index -= offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::Iterator::operator+(difference_type offset) const
+{
+    return Iterator(_array, _index + offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator Dataplex::IncrementalArray<T>::Iterator::operator-(difference_type offset) const
+{
+    return Iterator(_array, _index - offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::Iterator::difference_type
+Dataplex::IncrementalArray<T>::Iterator::operator-(const Iterator& iterator) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(iterator._index);
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator==(const Iterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator!=(const Iterator& iterator) const
+{
+    return _index != iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator<(const Iterator& iterator) const
+{
+    return _index < iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator>(const Iterator& iterator) const
+{
+    return _index > iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator<=(const Iterator& iterator) const
+{
+    return _index <= iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::Iterator::operator>=(const Iterator& iterator) const
+{
+    return _index >= iterator._index;
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::ConstIterator::ConstIterator() :
+    _array(nullptr),
+    _index(0)
+{
+}
+
+template<typename T>
+Dataplex::IncrementalArray<T>::ConstIterator::ConstIterator(const IncrementalArray<T>* array, std::size_t index) :
+    _array(array),
+    _index(index)
+{
+}
+
+template<typename T>
+const T& Dataplex::IncrementalArray<T>::ConstIterator::operator*() const
+{
+    return (*_array)[_index];
+}
+
+template<typename T>
+const T* Dataplex::IncrementalArray<T>::ConstIterator::operator->() const
+{
+    return &**this;
+}
+
+template<typename T>
+const T& Dataplex::IncrementalArray<T>::ConstIterator::operator[](difference_type offset) const
+{
+    return *(*this + offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator& Dataplex::IncrementalArray<T>::ConstIterator::operator++()
+{
+    ++_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator& Dataplex::IncrementalArray<T>::ConstIterator::operator--()
+{
+    --_index;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::ConstIterator::operator--(int)
+{
+    auto iterator = *this;
+    --*this;
+
+    return iterator;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator& Dataplex::IncrementalArray<T>::ConstIterator::operator+=(difference_type offset)
+{
+    _index += offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator& Dataplex::IncrementalArray<T>::ConstIterator::operator-=(difference_type offset)
+{
+    _index -= offset;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::ConstIterator::operator+(difference_type offset) const
+{
+    return ConstIterator(_array, _index + offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator Dataplex::IncrementalArray<T>::ConstIterator::operator-(difference_type offset) const
+{
+    return ConstIterator(_array, _index - offset);
+}
+
+template<typename T>
+typename Dataplex::IncrementalArray<T>::ConstIterator::difference_type
+Dataplex::IncrementalArray<T>::ConstIterator::operator-(const ConstIterator& iterator) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(iterator._index);
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return _index != iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator<(const ConstIterator& iterator) const
+{
+    return _index < iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator>(const ConstIterator& iterator) const
+{
+    return _index > iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator<=(const ConstIterator& iterator) const
+{
+    return _index <= iterator._index;
+}
+
+template<typename T>
+bool Dataplex::IncrementalArray<T>::ConstIterator::operator>=(const ConstIterator& iterator) const
+{
+    return _index >= iterator._index;
+}
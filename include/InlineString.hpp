@@ -0,0 +1,295 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - InlineString.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <string_view>
+
+
+namespace Dataplex
+{
+    class InlineString
+    {
+    public:
+        static constexpr std::size_t Capacity = 22;
+
+        InlineString();
+        InlineString(const char* string);
+        InlineString(std::string_view string);
+        InlineString(const InlineString& string);
+        InlineString& operator=(const InlineString& string);
+        InlineString(InlineString&& string);
+        InlineString& operator=(InlineString&& string);
+
+        ~InlineString();
+
+        operator std::string_view() const;
+
+        const char* begin() const;
+        const char* end() const;
+
+        const char& operator[](std::size_t index) const;
+
+        const char* data() const;
+        const char* c_str() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+        bool is_inline() const;
+
+    private:
+        static constexpr std::uint8_t HeapTag = 0xFF;
+
+        alignas(char*) char _buffer[Capacity + 2];
+
+        std::uint8_t tag() const;
+        char* heap_data() const;
+
+        void swap(InlineString& string);
+    };
+
+    bool operator==(const InlineString& left, const InlineString& right);
+    bool operator!=(const InlineString& left, const InlineString& right);
+    bool operator<(const InlineString& left, const InlineString& right);
+
+    bool operator==(const InlineString& left, std::string_view right);
+    bool operator!=(const InlineString& left, std::string_view right);
+
+    bool operator==(const InlineString& left, const char* right);
+    bool operator!=(const InlineString& left, const char* right);
+
+    namespace hash
+    {
+        template<>
+        class Hash<InlineString>
+        {
+        public:
+            using is_transparent = void;
+
+            Hash();
+            explicit Hash(std::uint64_t seed);
+
+            std::size_t operator()(const InlineString& value) const;
+            std::size_t operator()(std::string_view value) const;
+            std::size_t operator()(const char* value) const;
+
+        private:
+            std::uint64_t _seed;
+        };
+    }
+}
+
+inline Dataplex::InlineString::InlineString() :
+    _buffer()
+{
+}
+
+inline Dataplex::InlineString::InlineString(const char* string) :
+    InlineString(std::string_view(string))
+{
+}
+
+inline Dataplex::InlineString::InlineString(std::string_view string) :
+    _buffer()
+{
+    if (string.size() <= Capacity)
+    {
+        std::memcpy(_buffer, string.data(), string.size());
+        _buffer[Capacity + 1] = static_cast<char>(string.size());
+    }
+    else
+    {
+        auto data = new char[string.size() + 1];
+        auto size = string.size();
+
+        std::memcpy(data, string.data(), size);
+        data[size] = '\0';
+
+        std::memcpy(_buffer, &data, sizeof(data));
+        std::memcpy(_buffer + sizeof(data), &size, sizeof(size));
+        _buffer[Capacity + 1] = static_cast<char>(HeapTag);
+    }
+}
+
+inline Dataplex::InlineString::InlineString(const InlineString& string) :
+    InlineString(std::string_view(string))
+{
+}
+
+inline Dataplex::InlineString& Dataplex::InlineString::operator=(const InlineString& string)
+{
+    InlineString temp(string);
+    swap(temp);
+
+    return *this;
+}
+
+inline Dataplex::InlineString::InlineString(InlineString&& string) :
+    InlineString()
+{
+    swap(string);
+}
+
+inline Dataplex::InlineString& Dataplex::InlineString::operator=(InlineString&& string)
+{
+    swap(string);
+
+    return *this;
+}
+
+inline Dataplex::InlineString::~InlineString()
+{
+    if (!is_inline())
+    {
+        delete[] heap_data();
+    }
+}
+
+inline Dataplex::InlineString::operator std::string_view() const
+{
+    return std::string_view(data(), size());
+}
+
+inline const char* Dataplex::InlineString::begin() const
+{
+    return data();
+}
+
+inline const char* Dataplex::InlineString::end() const
+{
+    return data() + size();
+}
+
+inline const char& Dataplex::InlineString::operator[](std::size_t index) const
+{
+    if (index >= size())
+    {
+        throw std::out_of_range("Index position out of range!");
+    }
+
+    return data()[index];
+}
+
+inline const char* Dataplex::InlineString::data() const
+{
+    return is_inline() ? _buffer : heap_data();
+}
+
+inline const char* Dataplex::InlineString::c_str() const
+{
+    return data();
+}
+
+inline std::size_t Dataplex::InlineString::size() const
+{
+    if (is_inline())
+    {
+        return tag();
+    }
+
+    std::size_t size;
+    std::memcpy(&size, _buffer + sizeof(char*), sizeof(size));
+
+    return size;
+}
+
+inline bool Dataplex::InlineString::is_empty() const
+{
+    return size() == 0;
+}
+
+inline bool Dataplex::InlineString::is_inline() const
+{
+    return tag() != HeapTag;
+}
+
+inline std::uint8_t Dataplex::InlineString::tag() const
+{
+    return static_cast<std::uint8_t>(_buffer[Capacity + 1]);
+}
+
+inline char* Dataplex::InlineString::heap_data() const
+{
+    char* data;
+    std::memcpy(&data, _buffer, sizeof(data));
+
+    return data;
+}
+
+inline void Dataplex::InlineString::swap(InlineString& string)
+{
+    using std::swap;
+
+    swap(_buffer, string._buffer);
+}
+
+inline bool Dataplex::operator==(const InlineString& left, const InlineString& right)
+{
+    return left.size() == right.size() && std::memcmp(left.data(), right.data(), left.size()) == 0;
+}
+
+inline bool Dataplex::operator!=(const InlineString& left, const InlineString& right)
+{
+    return !(left == right);
+}
+
+inline bool Dataplex::operator<(const InlineString& left, const InlineString& right)
+{
+    return std::string_view(left) < std::string_view(right);
+}
+
+inline bool Dataplex::operator==(const InlineString& left, std::string_view right)
+{
+    return std::string_view(left) == right;
+}
+
+inline bool Dataplex::operator!=(const InlineString& left, std::string_view right)
+{
+    return !(left == right);
+}
+
+inline bool Dataplex::operator==(const InlineString& left, const char* right)
+{
+    return left == std::string_view(right);
+}
+
+inline bool Dataplex::operator!=(const InlineString& left, const char* right)
+{
+    return !(left == right);
+}
+
+inline Dataplex::hash::Hash<Dataplex::InlineString>::Hash() :
+    Hash(hash::seed())
+{
+}
+
+inline Dataplex::hash::Hash<Dataplex::InlineString>::Hash(std::uint64_t seed) :
+    _seed(seed)
+{
+}
+
+inline std::size_t Dataplex::hash::Hash<Dataplex::InlineString>::operator()(const InlineString& value) const
+{
+    return static_cast<std::size_t>(hash_bytes(value.data(), value.size(), _seed));
+}
+
+inline std::size_t Dataplex::hash::Hash<Dataplex::InlineString>::operator()(std::string_view value) const
+{
+    return static_cast<std::size_t>(hash_bytes(value.data(), value.size(), _seed));
+}
+
+inline std::size_t Dataplex::hash::Hash<Dataplex::InlineString>::operator()(const char* value) const
+{
+    return (*this)(std::string_view(value));
+}
@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - KWayMerge.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename Iterator, typename Compare = std::less<>>
+    class KWayMerge
+    {
+    public:
+        using Run = std::pair<Iterator, Iterator>;
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        using reference = typename std::iterator_traits<Iterator>::reference;
+
+        explicit KWayMerge(const DynamicArray<Run>& runs, Compare comp = Compare());
+
+        reference front() const;
+        std::size_t front_run() const;
+
+        void pop();
+
+        std::size_t run_count() const;
+        bool is_empty() const;
+
+    private:
+        DynamicArray<Run> _runs;
+        DynamicArray<std::size_t> _tree;
+        Compare _comp;
+
+        bool beats(std::size_t left, std::size_t right) const;
+        bool is_exhausted(std::size_t run) const;
+    };
+
+    template<typename Iterator, typename Output, typename Compare = std::less<>>
+    void k_way_merge(const DynamicArray<std::pair<Iterator, Iterator>>& runs, Output& out, Compare comp = Compare());
+}
+
+template<typename Iterator, typename Compare>
+Dataplex::KWayMerge<Iterator, Compare>::KWayMerge(const DynamicArray<Run>& runs, Compare comp) :
+    _runs(runs),
+    _tree(),
+    _comp(comp)
+{
+    auto count = _runs.size();
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    DynamicArray<std::size_t> winners;
+
+    winners.resize(2 * count);
+    _tree.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        winners[count + i] = i;
+    }
+
+    for (auto node = count - 1; node > 0; --node)
+    {
+        auto left = winners[2 * node];
+        auto right = winners[2 * node + 1];
+
+        if (beats(left, right))
+        {
+            winners[node] = left;
+            _tree[node] = right;
+        }
+        else
+        {
+            winners[node] = right;
+            _tree[node] = left;
+        }
+    }
+
+    _tree[0] = count > 1 ? winners[1] : 0;
+}
+
+template<typename Iterator, typename Compare>
+typename Dataplex::KWayMerge<Iterator, Compare>::reference Dataplex::KWayMerge<Iterator, Compare>::front() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No element exists in the k-way merge!");
+    }
+
+    return *_runs[_tree[0]].first;
+}
+
+template<typename Iterator, typename Compare>
+std::size_t Dataplex::KWayMerge<Iterator, Compare>::front_run() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No element exists in the k-way merge!");
+    }
+
+    return _tree[0];
+}
+
+template<typename Iterator, typename Compare>
+void Dataplex::KWayMerge<Iterator, Compare>::pop()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop empty k-way merge!");
+    }
+
+    auto winner = _tree[0];
+
+    ++_runs[winner].first;
+
+    for (auto node = (_runs.size() + winner) / 2; node > 0; node /= 2)
+    {
+        if (beats(_tree[node], winner))
+        {
+            std::swap(_tree[node], winner);
+        }
+    }
+
+    _tree[0] = winner;
+}
+
+template<typename Iterator, typename Compare>
+std::size_t Dataplex::KWayMerge<Iterator, Compare>::run_count() const
+{
+    return _runs.size();
+}
+
+template<typename Iterator, typename Compare>
+bool Dataplex::KWayMerge<Iterator, Compare>::is_empty() const
+{
+    return _runs.is_empty() || is_exhausted(_tree[0]);
+}
+
+template<typename Iterator, typename Compare>
+bool Dataplex::KWayMerge<Iterator, Compare>::beats(std::size_t left, std::size_t right) const
+{
+    if (is_exhausted(left))
+    {
+        return false;
+    }
+
+    if (is_exhausted(right))
+    {
+        return true;
+    }
+
+    const auto& first = *_runs[left].first;
+    const auto& second = *_runs[right].first;
+
+    if (_comp(first, second))
+    {
+        return true;
+    }
+
+    return !_comp(second, first) && left < right;
+}
+
+template<typename Iterator, typename Compare>
+bool Dataplex::KWayMerge<Iterator, Compare>::is_exhausted(std::size_t run) const
+{
+    return _runs[run].first == _runs[run].second;
+}
+
+template<typename Iterator, typename Output, typename Compare>
+void Dataplex::k_way_merge(const DynamicArray<std::pair<Iterator, Iterator>>& runs, Output& out, Compare comp)
+{
+    KWayMerge<Iterator, Compare> merge(runs, comp);
+
+    while (!merge.is_empty())
+    {
+        out.push_back(merge.front());
+        merge.pop();
+    }
+}
@@ -0,0 +1,419 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - LruCache.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Hash.hpp"
+#include "HashMap.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename Value, typename Hasher = hash::Hash<Key>>
+    class LruCache
+    {
+    public:
+        using Weigher = std::function<std::size_t(const Key&, const Value&)>;
+        using EvictionCallback = std::function<void(const Key&, Value&)>;
+
+        explicit LruCache(std::size_t capacity, Weigher weigher = Weigher(), const Hasher& hasher = Hasher());
+        LruCache(const LruCache<Key, Value, Hasher>& cache);
+        LruCache<Key, Value, Hasher>& operator=(const LruCache<Key, Value, Hasher>& cache);
+        LruCache(LruCache<Key, Value, Hasher>&& cache);
+        LruCache<Key, Value, Hasher>& operator=(LruCache<Key, Value, Hasher>&& cache);
+
+        Value* get(const Key& key);
+        const Value* peek(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        bool put(const Key& key, const Value& value);
+        bool put(Key&& key, Value&& value);
+        bool erase(const Key& key);
+
+        void set_eviction_callback(EvictionCallback callback);
+        void resize(std::size_t capacity);
+        void clear();
+
+        std::size_t size() const;
+        std::size_t weight() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+
+        std::size_t hits() const;
+        std::size_t misses() const;
+        std::size_t evictions() const;
+        void reset_statistics();
+
+    private:
+        struct Entry
+        {
+            template<typename K, typename V>
+            Entry(K&& key, V&& value, std::size_t weight);
+
+            Key key;
+            Value value;
+            std::size_t weight;
+        };
+
+        using List = DoublyLinkedList<Entry>;
+        using Position = typename List::Iterator;
+
+        List _list;
+        HashMap<Key, Position, Hasher> _map;
+        Hasher _hasher;
+
+        Weigher _weigher;
+        EvictionCallback _callback;
+
+        std::size_t _capacity;
+        std::size_t _weight;
+
+        std::size_t _hits;
+        std::size_t _misses;
+        std::size_t _evictions;
+
+        template<typename K, typename V>
+        bool insert(K&& key, V&& value);
+
+        std::size_t weigh(const Key& key, const Value& value) const;
+        void evict();
+        void swap(LruCache<Key, Value, Hasher>& cache);
+    };
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::LruCache<Key, Value, Hasher>::LruCache(std::size_t capacity, Weigher weigher, const Hasher& hasher) :
+    _list(),
+    _map(HashMap<Key, Position, Hasher>::Resize::Immediate, hasher),
+    _hasher(hasher),
+    _weigher(std::move(weigher)),
+    _callback(),
+    _capacity(capacity),
+    _weight(0),
+    _hits(0),
+    _misses(0),
+    _evictions(0)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Cache capacity must be greater than zero!");
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::LruCache<Key, Value, Hasher>::LruCache(const LruCache<Key, Value, Hasher>& cache) :
+    LruCache(cache._capacity, cache._weigher, cache._hasher)
+{
+    _callback = cache._callback;
+
+    for (auto entry = cache._list.rbegin(); entry != cache._list.rend(); ++entry)
+    {
+        _list.emplace_front(entry->key, entry->value, entry->weight);
+        _map.emplace(entry->key, _list.begin());
+
+        _weight += entry->weight;
+    }
+
+    _hits = cache._hits;
+    _misses = cache._misses;
+    _evictions = cache._evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::LruCache<Key, Value, Hasher>& Dataplex::LruCache<Key, Value, Hasher>::operator=(const LruCache<Key, Value, Hasher>& cache)
+{
+    LruCache<Key, Value, Hasher> temp(cache);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::LruCache<Key, Value, Hasher>::LruCache(LruCache<Key, Value, Hasher>&& cache) :
+    LruCache(cache._capacity, Weigher(), cache._hasher)
+{
+    swap(cache);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::LruCache<Key, Value, Hasher>& Dataplex::LruCache<Key, Value, Hasher>::operator=(LruCache<Key, Value, Hasher>&& cache)
+{
+    swap(cache);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value* Dataplex::LruCache<Key, Value, Hasher>::get(const Key& key)
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        ++_misses;
+
+        return nullptr;
+    }
+
+    ++_hits;
+
+    _list.move_to_front(found->second);
+
+    return &found->second->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+const Value* Dataplex::LruCache<Key, Value, Hasher>::peek(const Key& key) const
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return nullptr;
+    }
+
+    auto position = found->second;
+
+    return &position->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::LruCache<Key, Value, Hasher>::contains(const Key& key) const
+{
+    return _map.contains(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::LruCache<Key, Value, Hasher>::put(const Key& key, const Value& value)
+{
+    return insert(key, value);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::LruCache<Key, Value, Hasher>::put(Key&& key, Value&& value)
+{
+    return insert(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::LruCache<Key, Value, Hasher>::erase(const Key& key)
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return false;
+    }
+
+    auto position = found->second;
+
+    _weight -= position->weight;
+
+    _map.erase(key);
+    _list.erase(position);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::set_eviction_callback(EvictionCallback callback)
+{
+    _callback = std::move(callback);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::resize(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Cache capacity must be greater than zero!");
+    }
+
+    _capacity = capacity;
+
+    evict();
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::clear()
+{
+    _list.clear();
+    _map.clear();
+
+    _weight = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::size() const
+{
+    return _list.size();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::weight() const
+{
+    return _weight;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::LruCache<Key, Value, Hasher>::is_empty() const
+{
+    return _list.is_empty();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::hits() const
+{
+    return _hits;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::misses() const
+{
+    return _misses;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::evictions() const
+{
+    return _evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::reset_statistics()
+{
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+Dataplex::LruCache<Key, Value, Hasher>::Entry::Entry(K&& key, V&& value, std::size_t weight) :
+    key(std::forward<K>(key)),
+    value(std::forward<V>(value)),
+    weight(weight)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+bool Dataplex::LruCache<Key, Value, Hasher>::insert(K&& key, V&& value)
+{
+    auto weight = weigh(key, value);
+
+    if (weight > _capacity)
+    {
+        erase(key);
+
+        return false;
+    }
+
+    auto found = _map.find(key);
+
+    if (found != _map.end())
+    {
+        auto position = found->second;
+
+        _weight = _weight - position->weight + weight;
+
+        position->value = std::forward<V>(value);
+        position->weight = weight;
+
+        _list.move_to_front(position);
+    }
+    else if (!_weigher && _list.size() == _capacity)
+    {
+        auto victim = _map.find(_list.tail().key);
+        auto position = victim->second;
+
+        if (_callback)
+        {
+            _callback(position->key, position->value);
+        }
+
+        _map.erase(position->key);
+
+        position->key = key;
+        position->value = std::forward<V>(value);
+
+        _list.move_to_front(position);
+        _map.emplace(std::forward<K>(key), position);
+
+        ++_evictions;
+
+        return true;
+    }
+    else
+    {
+        _list.emplace_front(key, std::forward<V>(value), weight);
+        _map.emplace(std::forward<K>(key), _list.begin());
+
+        _weight += weight;
+    }
+
+    evict();
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::LruCache<Key, Value, Hasher>::weigh(const Key& key, const Value& value) const
+{
+    return _weigher ? _weigher(key, value) : 1;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::evict()
+{
+    while (_weight > _capacity && !_list.is_empty())
+    {
+        auto victim = _map.find(_list.tail().key);
+        auto position = victim->second;
+
+        if (_callback)
+        {
+            _callback(position->key, position->value);
+        }
+
+        _weight -= position->weight;
+
+        _map.erase(position->key);
+        _list.erase(position);
+
+        ++_evictions;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::LruCache<Key, Value, Hasher>::swap(LruCache<Key, Value, Hasher>& cache)
+{
+    using std::swap;
+
+    swap(_list, cache._list);
+    swap(_map, cache._map);
+    swap(_hasher, cache._hasher);
+    swap(_weigher, cache._weigher);
+    swap(_callback, cache._callback);
+    swap(_capacity, cache._capacity);
+    swap(_weight, cache._weight);
+    swap(_hits, cache._hits);
+    swap(_misses, cache._misses);
+    swap(_evictions, cache._evictions);
+}
@@ -0,0 +1,480 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - MappedArray.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <string>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+namespace Dataplex
+{
+    template<typename T>
+    class MappedArray
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Mapped array elements must be trivially copyable!");
+        static_assert(alignof(T) <= 64, "Mapped array elements can't be aligned past the file header!");
+
+    public:
+        explicit MappedArray(const std::string& path);
+        MappedArray(const MappedArray<T>& array) = delete;
+        MappedArray<T>& operator=(const MappedArray<T>& array) = delete;
+        MappedArray(MappedArray<T>&& array);
+        MappedArray<T>& operator=(MappedArray<T>&& array);
+
+        ~MappedArray();
+
+        T* begin();
+        const T* begin() const;
+
+        T* end();
+        const T* end() const;
+
+        std::reverse_iterator<T*> rbegin();
+        std::reverse_iterator<const T*> rbegin() const;
+
+        std::reverse_iterator<T*> rend();
+        std::reverse_iterator<const T*> rend() const;
+
+        T& operator[](std::size_t pos);
+        const T& operator[](std::size_t pos) const;
+
+        void push_back(const T& data);
+        void pop_back();
+
+        void insert(const T& data, std::size_t pos);
+        void erase(std::size_t pos);
+
+        void reserve(std::size_t capacity);
+        void shrink_to_fit();
+        void clear();
+
+        void sync();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_read_only() const;
+
+    private:
+        struct Header
+        {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t elementSize;
+            std::uint64_t size;
+        };
+
+        static constexpr std::uint64_t Magic = 0x4150414D58504C44;
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::size_t HeaderSize = 64;
+        static constexpr std::size_t InitialCapacity = 64;
+        static constexpr bool ReadOnly = std::is_const<T>::value;
+
+        int _file;
+        std::size_t _capacity;
+        std::size_t _mappingSize;
+        void* _mapping;
+        Header* _header;
+        T* _array;
+
+        MappedArray();
+
+        void map(std::size_t mappingSize);
+        void remap(std::size_t mappingSize);
+
+        void swap(MappedArray<T>& array);
+    };
+}
+
+template<typename T>
+Dataplex::MappedArray<T>::MappedArray() :
+    _file(-1),
+    _capacity(0),
+    _mappingSize(0),
+    _mapping(nullptr),
+    _header(nullptr),
+    _array(nullptr)
+{
+}
+
+template<typename T>
+Dataplex::MappedArray<T>::MappedArray(const std::string& path) :
+    MappedArray()
+{
+    _file = ::open(path.c_str(), ReadOnly ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+
+    if (_file == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't open mapped array file!");
+    }
+
+    struct stat status;
+
+    if (::fstat(_file, &status) == -1)
+    {
+        auto error = errno;
+        ::close(_file);
+
+        throw std::system_error(error, std::generic_category(), "Can't read mapped array file size!");
+    }
+
+    auto fileSize = static_cast<std::size_t>(status.st_size);
+
+    try
+    {
+        if (fileSize == 0 && ReadOnly)
+        {
+            throw std::runtime_error("Can't open empty mapped array file as read-only!");
+        }
+        else if (fileSize == 0)
+        {
+            fileSize = HeaderSize + InitialCapacity * sizeof(T);
+
+            if (::ftruncate(_file, static_cast<off_t>(fileSize)) == -1)
+            {
+                throw std::system_error(errno, std::generic_category(), "Can't resize mapped array file!");
+            }
+
+            map(fileSize);
+
+            _header->magic = Magic;
+            _header->version = Version;
+            _header->elementSize = sizeof(T);
+            _header->size = 0;
+        }
+        else if (fileSize < HeaderSize)
+        {
+            throw std::runtime_error("Mapped array file is too small!");
+        }
+        else
+        {
+            map(fileSize);
+
+            if (_header->magic != Magic || _header->version != Version || _header->elementSize != sizeof(T) ||
+                _header->size > _capacity)
+            {
+                throw std::runtime_error("Mapped array file has an incompatible header!");
+            }
+        }
+    }
+    catch (...)
+    {
+        if (_mapping)
+        {
+            ::munmap(_mapping, _mappingSize);
+        }
+
+        ::close(_file);
+
+        throw;
+    }
+}
+
+template<typename T>
+Dataplex::MappedArray<T>::MappedArray(MappedArray<T>&& array) :
+    MappedArray()
+{
+    swap(array);
+}
+
+template<typename T>
+Dataplex::MappedArray<T>& Dataplex::MappedArray<T>::operator=(MappedArray<T>&& array)
+{
+    swap(array);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::MappedArray<T>::~MappedArray()
+{
+    if (_mapping)
+    {
+        ::munmap(_mapping, _mappingSize);
+    }
+
+    if (_file != -1)
+    {
+        ::close(_file);
+    }
+}
+
+template<typename T>
+T* Dataplex::MappedArray<T>::begin()
+{
+    return _array;
+}
+
+template<typename T>
+const T* Dataplex::MappedArray<T>::begin() const
+{
+    return _array;
+}
+
+template<typename T>
+T* Dataplex::MappedArray<T>::end()
+{
+    return _array + size();
+}
+
+template<typename T>
+const T* Dataplex::MappedArray<T>::end() const
+{
+    return _array + size();
+}
+
+template<typename T>
+std::reverse_iterator<T*> Dataplex::MappedArray<T>::rbegin()
+{
+    return std::make_reverse_iterator<T*>(end());
+}
+
+template<typename T>
+std::reverse_iterator<const T*> Dataplex::MappedArray<T>::rbegin() const
+{
+    return std::make_reverse_iterator<const T*>(end());
+}
+
+template<typename T>
+std::reverse_iterator<T*> Dataplex::MappedArray<T>::rend()
+{
+    return std::make_reverse_iterator<T*>(begin());
+}
+
+template<typename T>
+std::reverse_iterator<const T*> Dataplex::MappedArray<T>::rend() const
+{
+    return std::make_reverse_iterator<const T*>(begin());
+}
+
+template<typename T>
+T& Dataplex::MappedArray<T>::operator[](std::size_t pos)
+{
+    return _array[pos];
+}
+
+template<typename T>
+const T& Dataplex::MappedArray<T>::operator[](std::size_t pos) const
+{
+    return _array[pos];
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::push_back(const T& data)
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    if (size() == _capacity)
+    {
+        reserve(_capacity * 2);
+    }
+
+    _array[_header->size++] = data;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::pop_back()
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop back empty mapped array!");
+    }
+
+    --_header->size;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::insert(const T& data, std::size_t pos)
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    if (pos > size())
+    {
+        throw std::out_of_range("Insert position outside of existing range!");
+    }
+
+    if (size() == _capacity)
+    {
+        reserve(_capacity * 2);
+    }
+
+    std::memmove(_array + pos + 1, _array + pos, (size() - pos) * sizeof(T));
+    _array[pos] = data;
+
+    ++_header->size;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::erase(std::size_t pos)
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    if (pos >= size())
+    {
+        throw std::out_of_range("Erase position outside of existing range!");
+    }
+
+    std::memmove(_array + pos, _array + pos + 1, (size() - pos - 1) * sizeof(T));
+
+    --_header->size;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::reserve(std::size_t capacity)
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    if (capacity <= _capacity)
+    {
+        return;
+    }
+
+    auto mappingSize = HeaderSize + capacity * sizeof(T);
+
+    if (::ftruncate(_file, static_cast<off_t>(mappingSize)) == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't resize mapped array file!");
+    }
+
+    remap(mappingSize);
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::shrink_to_fit()
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    auto capacity = std::max<std::size_t>(size(), 1);
+    auto mappingSize = HeaderSize + capacity * sizeof(T);
+
+    if (capacity == _capacity)
+    {
+        return;
+    }
+
+    remap(mappingSize);
+
+    if (::ftruncate(_file, static_cast<off_t>(mappingSize)) == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't resize mapped array file!");
+    }
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::clear()
+{
+    static_assert(!ReadOnly, "Can't modify read-only mapped array!");
+
+    _header->size = 0;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::sync()
+{
+    if (!ReadOnly && ::msync(_mapping, _mappingSize, MS_SYNC) == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't sync mapped array file!");
+    }
+}
+
+template<typename T>
+std::size_t Dataplex::MappedArray<T>::size() const
+{
+    return _header ? static_cast<std::size_t>(_header->size) : 0;
+}
+
+template<typename T>
+std::size_t Dataplex::MappedArray<T>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename T>
+bool Dataplex::MappedArray<T>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename T>
+bool Dataplex::MappedArray<T>::is_read_only() const
+{
+    return ReadOnly;
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::map(std::size_t mappingSize)
+{
+    auto protection = ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    auto mapping = ::mmap(nullptr, mappingSize, protection, MAP_SHARED, _file, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't map mapped array file!");
+    }
+
+    _mapping = mapping;
+    _mappingSize = mappingSize;
+    _header = static_cast<Header*>(_mapping);
+    _array = reinterpret_cast<T*>(static_cast<unsigned char*>(_mapping) + HeaderSize);
+    _capacity = (mappingSize - HeaderSize) / sizeof(T);
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::remap(std::size_t mappingSize)
+{
+#ifdef MREMAP_MAYMOVE
+    auto mapping = ::mremap(_mapping, _mappingSize, mappingSize, MREMAP_MAYMOVE);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't remap mapped array file!");
+    }
+
+    _mapping = mapping;
+    _mappingSize = mappingSize;
+    _header = static_cast<Header*>(_mapping);
+    _array = reinterpret_cast<T*>(static_cast<unsigned char*>(_mapping) + HeaderSize);
+    _capacity = (mappingSize - HeaderSize) / sizeof(T);
+#else
+    auto oldMapping = _mapping;
+    auto oldMappingSize = _mappingSize;
+
+    map(mappingSize);
+
+    ::munmap(oldMapping, oldMappingSize);
+#endif
+}
+
+template<typename T>
+void Dataplex::MappedArray<T>::swap(MappedArray<T>& array)
+{
+    using std::swap;
+
+    swap(_file, array._file);
+    swap(_capacity, array._capacity);
+    swap(_mappingSize, array._mappingSize);
+    swap(_mapping, array._mapping);
+    swap(_header, array._header);
+    swap(_array, array._array);
+}
@@ -0,0 +1,388 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Parallel.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Utility.hpp"
+#include "ThreadPool.hpp"
+
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    namespace parallel
+    {
+        template<typename Range, typename Function>
+        void for_each(Range& range, Function function, std::size_t grainSize = 0,
+            ThreadPool& pool = ThreadPool::global());
+
+        template<typename InputRange, typename OutputRange, typename Function>
+        void transform(const InputRange& input, OutputRange& output, Function function, std::size_t grainSize = 0,
+            ThreadPool& pool = ThreadPool::global());
+
+        template<typename Range, typename T, typename BinaryOperation = std::plus<>>
+        T reduce(const Range& range, T init, BinaryOperation operation = BinaryOperation(), std::size_t grainSize = 0,
+            ThreadPool& pool = ThreadPool::global());
+
+        template<typename Range, typename Compare = std::less<>>
+        void sort(Range& range, Compare comp = Compare(), std::size_t grainSize = 0,
+            ThreadPool& pool = ThreadPool::global());
+
+        template<typename InputRange, typename OutputRange, typename BinaryOperation = std::plus<>>
+        void inclusive_scan(const InputRange& input, OutputRange& output, BinaryOperation operation = BinaryOperation(),
+            std::size_t grainSize = 0, ThreadPool& pool = ThreadPool::global());
+
+        template<typename Range, typename Predicate>
+        auto partition(Range& range, Predicate predicate, std::size_t grainSize = 0,
+            ThreadPool& pool = ThreadPool::global()) -> decltype(range.begin());
+
+        namespace detail
+        {
+            std::size_t resolve_grain_size(std::size_t size, std::size_t grainSize, const ThreadPool& pool);
+            std::size_t chunk_count(std::size_t size, std::size_t grainSize);
+
+            template<typename RandomIt, typename OutputIt, typename Compare>
+            void merge(RandomIt first1, RandomIt last1, RandomIt first2, RandomIt last2, OutputIt result,
+                Compare comp, std::size_t grainSize, ThreadPool& pool);
+
+            template<typename RandomIt, typename BufferIt, typename Compare>
+            void merge_sort(RandomIt data, BufferIt buffer, std::size_t size, bool intoBuffer,
+                Compare comp, std::size_t grainSize, ThreadPool& pool);
+        }
+    }
+}
+
+template<typename Range, typename Function>
+void Dataplex::parallel::for_each(Range& range, Function function, std::size_t grainSize, ThreadPool& pool)
+{
+    auto first = range.begin();
+    auto size = static_cast<std::size_t>(std::distance(first, range.end()));
+
+    pool.parallel_for(0, size, detail::resolve_grain_size(size, grainSize, pool),
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                function(first[i]);
+            }
+        });
+}
+
+template<typename InputRange, typename OutputRange, typename Function>
+void Dataplex::parallel::transform(const InputRange& input, OutputRange& output, Function function,
+    std::size_t grainSize, ThreadPool& pool)
+{
+    auto inputFirst = input.begin();
+    auto outputFirst = output.begin();
+    auto size = static_cast<std::size_t>(std::distance(inputFirst, input.end()));
+
+    if (static_cast<std::size_t>(std::distance(outputFirst, output.end())) < size)
+    {
+        throw std::out_of_range("Output range smaller than input range!");
+    }
+
+    pool.parallel_for(0, size, detail::resolve_grain_size(size, grainSize, pool),
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                outputFirst[i] = function(inputFirst[i]);
+            }
+        });
+}
+
+template<typename Range, typename T, typename BinaryOperation>
+T Dataplex::parallel::reduce(const Range& range, T init, BinaryOperation operation, std::size_t grainSize,
+    ThreadPool& pool)
+{
+    auto first = range.begin();
+    auto size = static_cast<std::size_t>(std::distance(first, range.end()));
+
+    if (size == 0)
+    {
+        return init;
+    }
+
+    grainSize = detail::resolve_grain_size(size, grainSize, pool);
+
+    auto chunks = detail::chunk_count(size, grainSize);
+    std::unique_ptr<std::optional<T>[]> partials(new std::optional<T>[chunks]);
+
+    pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (auto chunk = begin; chunk < end; ++chunk)
+            {
+                auto chunkBegin = chunk * grainSize;
+                auto chunkEnd = std::min(chunkBegin + grainSize, size);
+
+                T value = first[chunkBegin];
+
+                for (auto i = chunkBegin + 1; i < chunkEnd; ++i)
+                {
+                    value = operation(std::move(value), first[i]);
+                }
+
+                partials[chunk].emplace(std::move(value));
+            }
+        });
+
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+        init = operation(std::move(init), *partials[chunk]);
+    }
+
+    return init;
+}
+
+template<typename Range, typename Compare>
+void Dataplex::parallel::sort(Range& range, Compare comp, std::size_t grainSize, ThreadPool& pool)
+{
+    auto first = range.begin();
+    auto size = static_cast<std::size_t>(std::distance(first, range.end()));
+
+    grainSize = detail::resolve_grain_size(size, grainSize, pool);
+
+    if (size <= grainSize)
+    {
+        std::sort(first, first + size, comp);
+
+        return;
+    }
+
+    using T = typename std::iterator_traits<decltype(first)>::value_type;
+
+    Dataplex::detail::ScratchBuffer<T> buffer(first, size);
+
+    detail::merge_sort(buffer.get(), first, size, true, comp, grainSize, pool);
+}
+
+template<typename InputRange, typename OutputRange, typename BinaryOperation>
+void Dataplex::parallel::inclusive_scan(const InputRange& input, OutputRange& output, BinaryOperation operation,
+    std::size_t grainSize, ThreadPool& pool)
+{
+    auto inputFirst = input.begin();
+    auto outputFirst = output.begin();
+    auto size = static_cast<std::size_t>(std::distance(inputFirst, input.end()));
+
+    if (static_cast<std::size_t>(std::distance(outputFirst, output.end())) < size)
+    {
+        throw std::out_of_range("Output range smaller than input range!");
+    }
+    else if (size == 0)
+    {
+        return;
+    }
+
+    grainSize = detail::resolve_grain_size(size, grainSize, pool);
+
+    using T = typename std::iterator_traits<decltype(outputFirst)>::value_type;
+
+    auto chunks = detail::chunk_count(size, grainSize);
+    std::unique_ptr<std::optional<T>[]> partials(new std::optional<T>[chunks]);
+
+    pool.parallel_for(0, chunks - 1, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (auto chunk = begin; chunk < end; ++chunk)
+            {
+                auto chunkBegin = chunk * grainSize;
+                auto chunkEnd = chunkBegin + grainSize;
+
+                T value = inputFirst[chunkBegin];
+
+                for (auto i = chunkBegin + 1; i < chunkEnd; ++i)
+                {
+                    value = operation(std::move(value), inputFirst[i]);
+                }
+
+                partials[chunk].emplace(std::move(value));
+            }
+        });
+
+    for (std::size_t chunk = 1; chunk + 1 < chunks; ++chunk)
+    {
+        partials[chunk].emplace(operation(*partials[chunk - 1], *partials[chunk]));
+    }
+
+    pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (auto chunk = begin; chunk < end; ++chunk)
+            {
+                auto chunkBegin = chunk * grainSize;
+                auto chunkEnd = std::min(chunkBegin + grainSize, size);
+
+                T value = chunk == 0 ? T(inputFirst[chunkBegin]) : operation(*partials[chunk - 1], inputFirst[chunkBegin]);
+                outputFirst[chunkBegin] = value;
+
+                for (auto i = chunkBegin + 1; i < chunkEnd; ++i)
+                {
+                    value = operation(std::move(value), inputFirst[i]);
+                    outputFirst[i] = value;
+                }
+            }
+        });
+}
+
+template<typename Range, typename Predicate>
+auto Dataplex::parallel::partition(Range& range, Predicate predicate, std::size_t grainSize,
+    ThreadPool& pool) -> decltype(range.begin())
+{
+    auto first = range.begin();
+    auto size = static_cast<std::size_t>(std::distance(first, range.end()));
+
+    grainSize = detail::resolve_grain_size(size, grainSize, pool);
+
+    if (size <= grainSize)
+    {
+        return std::stable_partition(first, first + size, predicate);
+    }
+
+    using T = typename std::iterator_traits<decltype(first)>::value_type;
+
+    auto chunks = detail::chunk_count(size, grainSize);
+    std::unique_ptr<bool[]> flags(new bool[size]);
+    std::unique_ptr<std::size_t[]> offsets(new std::size_t[chunks + 1]);
+
+    pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (auto chunk = begin; chunk < end; ++chunk)
+            {
+                auto chunkBegin = chunk * grainSize;
+                auto chunkEnd = std::min(chunkBegin + grainSize, size);
+
+                std::size_t count = 0;
+
+                for (auto i = chunkBegin; i < chunkEnd; ++i)
+                {
+                    flags[i] = static_cast<bool>(predicate(first[i]));
+                    count += flags[i];
+                }
+
+                offsets[chunk + 1] = count;
+            }
+        });
+
+    offsets[0] = 0;
+
+    for (std::size_t chunk = 1; chunk <= chunks; ++chunk)
+    {
+        offsets[chunk] += offsets[chunk - 1];
+    }
+
+    auto selected = offsets[chunks];
+    Dataplex::detail::ScratchBuffer<T> buffer(first, size);
+
+    pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (auto chunk = begin; chunk < end; ++chunk)
+            {
+                auto chunkBegin = chunk * grainSize;
+                auto chunkEnd = std::min(chunkBegin + grainSize, size);
+
+                auto selectedPos = offsets[chunk];
+                auto rejectedPos = selected + chunkBegin - offsets[chunk];
+
+                for (auto i = chunkBegin; i < chunkEnd; ++i)
+                {
+                    first[flags[i] ? selectedPos++ : rejectedPos++] = std::move(buffer.get()[i]);
+                }
+            }
+        });
+
+    return first + selected;
+}
+
+inline std::size_t Dataplex::parallel::detail::resolve_grain_size(std::size_t size, std::size_t grainSize,
+    const ThreadPool& pool)
+{
+    return grainSize == 0 ? pool.default_grain_size(size) : grainSize;
+}
+
+inline std::size_t Dataplex::parallel::detail::chunk_count(std::size_t size, std::size_t grainSize)
+{
+    return (size + grainSize - 1) / grainSize;
+}
+
+template<typename RandomIt, typename OutputIt, typename Compare>
+void Dataplex::parallel::detail::merge(RandomIt first1, RandomIt last1, RandomIt first2, RandomIt last2,
+    OutputIt result, Compare comp, std::size_t grainSize, ThreadPool& pool)
+{
+    auto size1 = static_cast<std::size_t>(last1 - first1);
+    auto size2 = static_cast<std::size_t>(last2 - first2);
+
+    if (size1 + size2 <= grainSize)
+    {
+        std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+            std::make_move_iterator(first2), std::make_move_iterator(last2), result, comp);
+
+        return;
+    }
+
+    RandomIt middle1;
+    RandomIt middle2;
+    RandomIt next1;
+    RandomIt next2;
+
+    if (size1 >= size2)
+    {
+        middle1 = first1 + size1 / 2;
+        middle2 = std::lower_bound(first2, last2, *middle1, comp);
+        next1 = middle1 + 1;
+        next2 = middle2;
+    }
+    else
+    {
+        middle2 = first2 + size2 / 2;
+        middle1 = std::upper_bound(first1, last1, *middle2, comp);
+        next1 = middle1;
+        next2 = middle2 + 1;
+    }
+
+    auto middleResult = result + (middle1 - first1) + (middle2 - first2);
+    *middleResult = std::move(size1 >= size2 ? *middle1 : *middle2);
+
+    pool.fork_join([&]() { merge(first1, middle1, first2, middle2, result, comp, grainSize, pool); },
+        [&]() { merge(next1, last1, next2, last2, middleResult + 1, comp, grainSize, pool); });
+}
+
+template<typename RandomIt, typename BufferIt, typename Compare>
+void Dataplex::parallel::detail::merge_sort(RandomIt data, BufferIt buffer, std::size_t size, bool intoBuffer,
+    Compare comp, std::size_t grainSize, ThreadPool& pool)
+{
+    if (size <= grainSize)
+    {
+        std::sort(data, data + size, comp);
+
+        if (intoBuffer)
+        {
+            std::move(data, data + size, buffer);
+        }
+
+        return;
+    }
+
+    auto half = size / 2;
+
+    pool.fork_join([&]() { merge_sort(data, buffer, half, !intoBuffer, comp, grainSize, pool); },
+        [&]() { merge_sort(data + half, buffer + half, size - half, !intoBuffer, comp, grainSize, pool); });
+
+    if (intoBuffer)
+    {
+        merge(data, data + half, data + half, data + size, buffer, comp, grainSize, pool);
+    }
+    else
+    {
+        merge(buffer, buffer + half, buffer + half, buffer + size, data, comp, grainSize, pool);
+    }
+}
@@ -0,0 +1,799 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - PersistentVector.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    template<typename T>
+    class PersistentVector
+    {
+    public:
+        PersistentVector();
+        PersistentVector(const PersistentVector<T>& vector);
+        PersistentVector<T>& operator=(const PersistentVector<T>& vector);
+        PersistentVector(PersistentVector<T>&& vector);
+        PersistentVector<T>& operator=(PersistentVector<T>&& vector);
+        PersistentVector(std::initializer_list<T> list);
+
+        ~PersistentVector();
+
+        class ConstIterator;
+        class Transient;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        const T& operator[](std::size_t index) const;
+
+        const T& head() const;
+        const T& tail() const;
+
+        PersistentVector<T> push_back(const T& value) const;
+        PersistentVector<T> push_back(T&& value) const;
+        PersistentVector<T> pop_back() const;
+
+        PersistentVector<T> set(std::size_t index, const T& value) const;
+        PersistentVector<T> set(std::size_t index, T&& value) const;
+
+        Transient transient() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t Bits = 5;
+        static constexpr std::size_t Width = std::size_t(1) << Bits;
+        static constexpr std::size_t Mask = Width - 1;
+
+        struct Node
+        {
+            Node();
+
+            std::atomic<std::size_t> references;
+        };
+
+        struct Branch : Node
+        {
+            Branch();
+
+            Node* children[Width];
+        };
+
+        struct Leaf : Node
+        {
+            Leaf();
+
+            T values[Width];
+            std::size_t count;
+        };
+
+        Branch* _root;
+        Leaf* _tail;
+        std::size_t _size;
+        std::size_t _shift;
+
+        template<typename U>
+        void append(U&& value);
+        void remove_last();
+        template<typename U>
+        void assign(std::size_t index, U&& value);
+
+        Leaf* leaf_at(std::size_t index) const;
+        std::size_t tail_offset() const;
+
+        void push_tail();
+        Branch* push_tail(std::size_t level, Branch* node, std::size_t offset);
+        Branch* pop_tail(std::size_t level, Branch* node, std::size_t index);
+        template<typename U>
+        Branch* assign(std::size_t level, Branch* node, std::size_t index, U&& value);
+        Node* new_path(std::size_t level, Leaf* leaf);
+
+        static void retain(Node* node);
+        static void release(Branch* node, std::size_t level);
+        static void release(Leaf* leaf);
+
+        static Branch* editable(Branch* node, std::size_t level);
+        static Leaf* editable(Leaf* leaf);
+
+        void swap(PersistentVector<T>& vector);
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator(const PersistentVector<T>* vector, std::size_t index);
+
+            const T& operator*() const;
+            const T* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const PersistentVector<T>* _vector;
+            const T* _values;
+            std::size_t _index;
+        };
+
+        class Transient
+        {
+        public:
+            explicit Transient(const PersistentVector<T>& vector);
+
+            const T& operator[](std::size_t index) const;
+
+            void push_back(const T& value);
+            void push_back(T&& value);
+            void pop_back();
+
+            void set(std::size_t index, const T& value);
+            void set(std::size_t index, T&& value);
+
+            PersistentVector<T> persistent() const;
+
+            std::size_t size() const;
+            bool is_empty() const;
+
+        private:
+            PersistentVector<T> _vector;
+        };
+    };
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::PersistentVector() :
+    _root(nullptr),
+    _tail(nullptr),
+    _size(0),
+    _shift(Bits)
+{
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::PersistentVector(const PersistentVector<T>& vector) :
+    _root(vector._root),
+    _tail(vector._tail),
+    _size(vector._size),
+    _shift(vector._shift)
+{
+    retain(_root);
+    retain(_tail);
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>& Dataplex::PersistentVector<T>::operator=(const PersistentVector<T>& vector)
+{
+    PersistentVector<T> temp(vector);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::PersistentVector(PersistentVector<T>&& vector) :
+    PersistentVector()
+{
+    swap(vector);
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>& Dataplex::PersistentVector<T>::operator=(PersistentVector<T>&& vector)
+{
+    swap(vector);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::PersistentVector(std::initializer_list<T> list) :
+    PersistentVector()
+{
+    for (const auto& value : list)
+    {
+        append(value);
+    }
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::~PersistentVector()
+{
+    release(_root, _shift);
+    release(_tail);
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::ConstIterator Dataplex::PersistentVector<T>::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::ConstIterator Dataplex::PersistentVector<T>::end() const
+{
+    return ConstIterator(this, _size);
+}
+
+template<typename T>
+const T& Dataplex::PersistentVector<T>::operator[](std::size_t index) const
+{
+    return leaf_at(index)->values[index & Mask];
+}
+
+template<typename T>
+const T& Dataplex::PersistentVector<T>::head() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return (*this)[0];
+}
+
+template<typename T>
+const T& Dataplex::PersistentVector<T>::tail() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return _tail->values[_tail->count - 1];
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::push_back(const T& value) const
+{
+    auto vector = *this;
+    vector.append(value);
+
+    return vector;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::push_back(T&& value) const
+{
+    auto vector = *this;
+    vector.append(std::move(value));
+
+    return vector;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::pop_back() const
+{
+    auto vector = *this;
+    vector.remove_last();
+
+    return vector;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::set(std::size_t index, const T& value) const
+{
+    auto vector = *this;
+    vector.assign(index, value);
+
+    return vector;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::set(std::size_t index, T&& value) const
+{
+    auto vector = *this;
+    vector.assign(index, std::move(value));
+
+    return vector;
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Transient Dataplex::PersistentVector<T>::transient() const
+{
+    return Transient(*this);
+}
+
+template<typename T>
+std::size_t Dataplex::PersistentVector<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+bool Dataplex::PersistentVector<T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::Node::Node() :
+    references(1)
+{
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::Branch::Branch() :
+    children()
+{
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::Leaf::Leaf() :
+    values(),
+    count(0)
+{
+}
+
+template<typename T>
+template<typename U>
+void Dataplex::PersistentVector<T>::append(U&& value)
+{
+    if (_tail && _tail->count < Width)
+    {
+        _tail = editable(_tail);
+        _tail->values[_tail->count++] = std::forward<U>(value);
+    }
+    else
+    {
+        auto leaf = new Leaf();
+
+        leaf->values[0] = std::forward<U>(value);
+        leaf->count = 1;
+
+        if (_tail)
+        {
+            push_tail();
+        }
+
+        _tail = leaf;
+    }
+
+    ++_size;
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::remove_last()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop back empty persistent vector!");
+    }
+
+    if (_tail->count > 1 || _size == 1)
+    {
+        _tail = editable(_tail);
+        _tail->values[--_tail->count] = T();
+
+        if (--_size == 0)
+        {
+            release(_tail);
+
+            _tail = nullptr;
+        }
+
+        return;
+    }
+
+    auto offset = tail_offset();
+    auto leaf = leaf_at(offset - 1);
+
+    retain(leaf);
+
+    _root = pop_tail(_shift, _root, offset - 1);
+
+    release(_tail);
+
+    _tail = leaf;
+    --_size;
+
+    if (!_root)
+    {
+        _shift = Bits;
+    }
+    else if (_shift > Bits && !_root->children[1])
+    {
+        auto child = static_cast<Branch*>(_root->children[0]);
+
+        retain(child);
+        release(_root, _shift);
+
+        _root = child;
+        _shift -= Bits;
+    }
+}
+
+template<typename T>
+template<typename U>
+void Dataplex::PersistentVector<T>::assign(std::size_t index, U&& value)
+{
+    if (index >= _size)
+    {
+        throw std::out_of_range("Index position out of range!");
+    }
+
+    if (index >= tail_offset())
+    {
+        _tail = editable(_tail);
+        _tail->values[index & Mask] = std::forward<U>(value);
+    }
+    else
+    {
+        _root = assign(_shift, _root, index, std::forward<U>(value));
+    }
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Leaf* Dataplex::PersistentVector<T>::leaf_at(std::size_t index) const
+{
+    if (index >= tail_offset())
+    {
+        return _tail;
+    }
+
+    Node* node = _root;
+
+    for (auto level = _shift; level > 0; level -= Bits)
+    {
+        node = static_cast<Branch*>(node)->children[(index >> level) & Mask];
+    }
+
+    return static_cast<Leaf*>(node);
+}
+
+template<typename T>
+std::size_t Dataplex::PersistentVector<T>::tail_offset() const
+{
+    return _tail ? _size - _tail->count : 0;
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::push_tail()
+{
+    auto offset = tail_offset();
+
+    if (!_root)
+    {
+        _root = new Branch();
+        _root->children[0] = _tail;
+    }
+    else if ((offset >> Bits) >= (std::size_t(1) << _shift))
+    {
+        auto root = new Branch();
+
+        root->children[0] = _root;
+        root->children[1] = new_path(_shift, _tail);
+
+        _root = root;
+        _shift += Bits;
+    }
+    else
+    {
+        _root = push_tail(_shift, _root, offset);
+    }
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Branch* Dataplex::PersistentVector<T>::push_tail(std::size_t level, Branch* node, std::size_t offset)
+{
+    node = editable(node, level);
+
+    auto index = (offset >> level) & Mask;
+
+    if (level == Bits)
+    {
+        node->children[index] = _tail;
+    }
+    else if (node->children[index])
+    {
+        node->children[index] = push_tail(level - Bits, static_cast<Branch*>(node->children[index]), offset);
+    }
+    else
+    {
+        node->children[index] = new_path(level - Bits, _tail);
+    }
+
+    return node;
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Branch* Dataplex::PersistentVector<T>::pop_tail(std::size_t level, Branch* node, std::size_t index)
+{
+    auto slot = (index >> level) & Mask;
+
+    if (level == Bits && slot == 0)
+    {
+        release(node, level);
+
+        return nullptr;
+    }
+
+    node = editable(node, level);
+
+    if (level > Bits)
+    {
+        auto child = pop_tail(level - Bits, static_cast<Branch*>(node->children[slot]), index);
+
+        node->children[slot] = child;
+
+        if (!child && slot == 0)
+        {
+            release(node, level);
+
+            return nullptr;
+        }
+    }
+    else
+    {
+        release(static_cast<Leaf*>(node->children[slot]));
+
+        node->children[slot] = nullptr;
+    }
+
+    return node;
+}
+
+template<typename T>
+template<typename U>
+typename Dataplex::PersistentVector<T>::Branch* Dataplex::PersistentVector<T>::assign(std::size_t level, Branch* node, std::size_t index, U&& value)
+{
+    node = editable(node, level);
+
+    auto slot = (index >> level) & Mask;
+
+    if (level == Bits)
+    {
+        auto leaf = editable(static_cast<Leaf*>(node->children[slot]));
+
+        leaf->values[index & Mask] = std::forward<U>(value);
+        node->children[slot] = leaf;
+    }
+    else
+    {
+        node->children[slot] = assign(level - Bits, static_cast<Branch*>(node->children[slot]), index, std::forward<U>(value));
+    }
+
+    return node;
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Node* Dataplex::PersistentVector<T>::new_path(std::size_t level, Leaf* leaf)
+{
+    if (level == 0)
+    {
+        return leaf;
+    }
+
+    auto branch = new Branch();
+    branch->children[0] = new_path(level - Bits, leaf);
+
+    return branch;
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::retain(Node* node)
+{
+    if (node)
+    {
+        node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::release(Branch* node, std::size_t level)
+{
+    if (!node || node->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    for (auto* child : node->children)
+    {
+        if (level > Bits)
+        {
+            release(static_cast<Branch*>(child), level - Bits);
+        }
+        else
+        {
+            release(static_cast<Leaf*>(child));
+        }
+    }
+
+    delete node;
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::release(Leaf* leaf)
+{
+    if (leaf && leaf->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete leaf;
+    }
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Branch* Dataplex::PersistentVector<T>::editable(Branch* node, std::size_t level)
+{
+    if (node->references.load(std::memory_order_acquire) == 1)
+    {
+        return node;
+    }
+
+    auto copy = new Branch();
+
+    for (std::size_t i = 0; i < Width; ++i)
+    {
+        copy->children[i] = node->children[i];
+
+        retain(copy->children[i]);
+    }
+
+    release(node, level);
+
+    return copy;
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::Leaf* Dataplex::PersistentVector<T>::editable(Leaf* leaf)
+{
+    if (leaf->references.load(std::memory_order_acquire) == 1)
+    {
+        return leaf;
+    }
+
+    auto copy = new Leaf();
+
+    for (std::size_t i = 0; i < leaf->count; ++i)
+    {
+        copy->values[i] = leaf->values[i];
+    }
+
+    copy->count = leaf->count;
+
+    release(leaf);
+
+    return copy;
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::swap(PersistentVector<T>& vector)
+{
+    using std::swap;
+
+    swap(_root, vector._root);
+    swap(_tail, vector._tail);
+    swap(_size, vector._size);
+    swap(_shift, vector._shift);
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::ConstIterator::ConstIterator(const PersistentVector<T>* vector, std::size_t index) :
+    _vector(vector),
+    _values(index < vector->_size ? vector->leaf_at(index)->values : nullptr),
+    _index(index)
+{
+}
+
+template<typename T>
+const T& Dataplex::PersistentVector<T>::ConstIterator::operator*() const
+{
+    return _values[_index & Mask];
+}
+
+template<typename T>
+const T* Dataplex::PersistentVector<T>::ConstIterator::operator->() const
+{
+    return &_values[_index & Mask];
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::ConstIterator& Dataplex::PersistentVector<T>::ConstIterator::operator++()
+{
+    if (++_index < _vector->_size && (_index & Mask) == 0)
+    {
+        _values = _vector->leaf_at(_index)->values;
+    }
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::PersistentVector<T>::ConstIterator Dataplex::PersistentVector<T>::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+template<typename T>
+bool Dataplex::PersistentVector<T>::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _index == iterator._index;
+}
+
+template<typename T>
+bool Dataplex::PersistentVector<T>::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+template<typename T>
+Dataplex::PersistentVector<T>::Transient::Transient(const PersistentVector<T>& vector) :
+    _vector(vector)
+{
+}
+
+template<typename T>
+const T& Dataplex::PersistentVector<T>::Transient::operator[](std::size_t index) const
+{
+    return _vector[index];
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::Transient::push_back(const T& value)
+{
+    _vector.append(value);
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::Transient::push_back(T&& value)
+{
+    _vector.append(std::move(value));
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::Transient::pop_back()
+{
+    _vector.remove_last();
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::Transient::set(std::size_t index, const T& value)
+{
+    _vector.assign(index, value);
+}
+
+template<typename T>
+void Dataplex::PersistentVector<T>::Transient::set(std::size_t index, T&& value)
+{
+    _vector.assign(index, std::move(value));
+}
+
+template<typename T>
+Dataplex::PersistentVector<T> Dataplex::PersistentVector<T>::Transient::persistent() const
+{
+    return _vector;
+}
+
+template<typename T>
+std::size_t Dataplex::PersistentVector<T>::Transient::size() const
+{
+    return _vector.size();
+}
+
+template<typename T>
+bool Dataplex::PersistentVector<T>::Transient::is_empty() const
+{
+    return _vector.is_empty();
+}
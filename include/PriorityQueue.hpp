@@ -10,13 +10,33 @@ http://inversepalindrome.com
 
 #include "DynamicArray.hpp"
 
+#include <cstddef>
+#include <utility>
+#include <iterator>
 #include <algorithm>
+#include <stdexcept>
 #include <functional>
+#include <type_traits>
 
 
 namespace Dataplex
 {
-    template<typename T, typename Comp = std::less<T>>
+    namespace detail
+    {
+        template<typename Compare>
+        struct InverseCompare
+        {
+            template<typename T>
+            bool operator()(const T& left, const T& right) const;
+
+            Compare comp;
+        };
+
+        template<typename RandomIt, typename Compare>
+        void sift_down(RandomIt first, std::size_t size, std::size_t index, Compare comp);
+    }
+
+    template<typename T, typename Comp = std::less<T>, typename Container = DynamicArray<T>>
     class PriorityQueue
     {
     public:
@@ -24,72 +44,452 @@ namespace Dataplex
         const T& front() const;
 
         void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
         void pop();
+        T pop_value();
+        bool try_pop(T& data);
+
+        template<typename Output>
+        std::size_t pop_n(std::size_t count, Output& out);
+
+        const Container& container() const;
 
         std::size_t size() const;
         bool is_empty() const;
 
     private:
-        DynamicArray<T> _array;
+        Container _container;
         Comp cmp;
     };
+
+    template<typename T, typename Compare = std::less<T>>
+    class TopK
+    {
+    public:
+        explicit TopK(std::size_t count, Compare comp = Compare());
+
+        bool push(const T& data);
+        bool push(T&& data);
+
+        const T& threshold() const;
+
+        DynamicArray<T> sorted() const;
+        DynamicArray<T> take();
+
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_full() const;
+
+    private:
+        DynamicArray<T> _heap;
+        std::size_t _count;
+        Compare _comp;
+
+        bool admits(const T& data) const;
+    };
+
+    template<typename Range, typename Compare = std::less<>>
+    auto top_k(const Range& range, std::size_t count, Compare comp = Compare());
+}
+
+template<typename Compare>
+template<typename T>
+bool Dataplex::detail::InverseCompare<Compare>::operator()(const T& left, const T& right) const
+{
+    return comp(right, left);
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::sift_down(RandomIt first, std::size_t size, std::size_t index, Compare comp)
+{
+    auto data = std::move(first[index]);
+
+    while (true)
+    {
+        auto child = 2 * index + 1;
+
+        if (child >= size)
+        {
+            break;
+        }
+
+        if (child + 1 < size && comp(first[child], first[child + 1]))
+        {
+            ++child;
+        }
+
+        if (!comp(data, first[child]))
+        {
+            break;
+        }
+
+        first[index] = std::move(first[child]);
+        index = child;
+    }
+
+    first[index] = std::move(data);
 }
 
-template<typename T, typename Comp>
-T& Dataplex::PriorityQueue<T, Comp>::front()
+template<typename T, typename Comp, typename Container>
+T& Dataplex::PriorityQueue<T, Comp, Container>::front()
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the priority queue!");
     }
 
-    return _array[0];
+    return _container.head();
 }
 
-template<typename T, typename Comp>
-const T& Dataplex::PriorityQueue<T, Comp>::front() const
+template<typename T, typename Comp, typename Container>
+const T& Dataplex::PriorityQueue<T, Comp, Container>::front() const
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the priority queue!");
     }
 
-    return _array[0];
+    return _container.head();
+}
+
+template<typename T, typename Comp, typename Container>
+void Dataplex::PriorityQueue<T, Comp, Container>::push(const T& data)
+{
+    _container.push_back(data);
+
+    std::push_heap(_container.begin(), _container.end(), cmp);
+}
+
+template<typename T, typename Comp, typename Container>
+void Dataplex::PriorityQueue<T, Comp, Container>::push(T&& data)
+{
+    _container.push_back(std::move(data));
+
+    std::push_heap(_container.begin(), _container.end(), cmp);
+}
+
+template<typename T, typename Comp, typename Container>
+template<typename... Args>
+void Dataplex::PriorityQueue<T, Comp, Container>::emplace(Args&&... args)
+{
+    _container.emplace_back(std::forward<Args>(args)...);
+
+    std::push_heap(_container.begin(), _container.end(), cmp);
+}
+
+template<typename T, typename Comp, typename Container>
+void Dataplex::PriorityQueue<T, Comp, Container>::pop()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop empty priority queue!");
+    }
+
+    std::pop_heap(_container.begin(), _container.end(), cmp);
+    _container.pop_back();
 }
 
-template<typename T, typename Comp>
-void Dataplex::PriorityQueue<T, Comp>::push(const T& data)
+template<typename T, typename Comp, typename Container>
+T Dataplex::PriorityQueue<T, Comp, Container>::pop_value()
 {
-    if (!is_empty())
+    if (is_empty())
     {
-        
+        throw std::out_of_range("Can't pop empty priority queue!");
     }
 
-    _array.push_back(data);
+    std::pop_heap(_container.begin(), _container.end(), cmp);
 
-    std::make_heap(_array.begin(), _array.end(), cmp);
+    T data = std::move(_container.tail());
+    _container.pop_back();
+
+    return data;
 }
 
-template<typename T, typename Comp>
-void Dataplex::PriorityQueue<T, Comp>::pop()
+template<typename T, typename Comp, typename Container>
+bool Dataplex::PriorityQueue<T, Comp, Container>::try_pop(T& data)
 {
     if (is_empty())
     {
-        throw std::out_of_range("Can't pop empty priority queue!");
+        return false;
+    }
+
+    std::pop_heap(_container.begin(), _container.end(), cmp);
+
+    data = std::move(_container.tail());
+    _container.pop_back();
+
+    return true;
+}
+
+template<typename T, typename Comp, typename Container>
+template<typename Output>
+std::size_t Dataplex::PriorityQueue<T, Comp, Container>::pop_n(std::size_t count, Output& out)
+{
+    auto size = _container.size();
+    auto data = _container.begin();
+
+    count = std::min(count, size);
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    std::size_t depth = 0;
+
+    while ((std::size_t(1) << depth) < size)
+    {
+        ++depth;
+    }
+
+    if (count * depth >= size)
+    {
+        detail::InverseCompare<Comp> inverse{ cmp };
+
+        std::nth_element(data, data + count - 1, data + size, inverse);
+        std::sort(data, data + count, inverse);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out.push_back(std::move(data[i]));
+        }
+
+        std::move(data + count, data + size, data);
+    }
+    else
+    {
+        DynamicArray<std::size_t> candidates(2 * count + 1);
+        DynamicArray<std::size_t> holes(count);
+
+        auto higher = [this, data](std::size_t left, std::size_t right)
+        {
+            return cmp(data[left], data[right]);
+        };
+
+        candidates.push_back(0);
+
+        while (holes.size() < count)
+        {
+            std::pop_heap(candidates.begin(), candidates.end(), higher);
+
+            auto index = candidates.tail();
+            candidates.pop_back();
+
+            out.push_back(std::move(data[index]));
+            holes.push_back(index);
+
+            for (auto child = 2 * index + 1; child <= 2 * index + 2 && child < size; ++child)
+            {
+                candidates.push_back(child);
+                std::push_heap(candidates.begin(), candidates.end(), higher);
+            }
+        }
+
+        std::sort(holes.begin(), holes.end(), std::greater<std::size_t>());
+
+        auto last = size;
+
+        for (auto hole : holes)
+        {
+            if (hole != --last)
+            {
+                data[hole] = std::move(data[last]);
+
+                detail::sift_down(data, last, hole, cmp);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        _container.pop_back();
+    }
+
+    if (count * depth >= size)
+    {
+        std::make_heap(_container.begin(), _container.end(), cmp);
+    }
+
+    return count;
+}
+
+template<typename T, typename Comp, typename Container>
+const Container& Dataplex::PriorityQueue<T, Comp, Container>::container() const
+{
+    return _container;
+}
+
+template<typename T, typename Comp, typename Container>
+std::size_t Dataplex::PriorityQueue<T, Comp, Container>::size() const
+{
+    return _container.size();
+}
+
+template<typename T, typename Comp, typename Container>
+bool Dataplex::PriorityQueue<T, Comp, Container>::is_empty() const
+{
+    return _container.is_empty();
+}
+
+template<typename T, typename Compare>
+Dataplex::TopK<T, Compare>::TopK(std::size_t count, Compare comp) :
+    _heap(count),
+    _count(count),
+    _comp(comp)
+{
+}
+
+template<typename T, typename Compare>
+bool Dataplex::TopK<T, Compare>::push(const T& data)
+{
+    if (!admits(data))
+    {
+        return false;
+    }
+
+    return push(T(data));
+}
+
+template<typename T, typename Compare>
+bool Dataplex::TopK<T, Compare>::push(T&& data)
+{
+    if (!admits(data))
+    {
+        return false;
+    }
+
+    detail::InverseCompare<Compare> inverse{ _comp };
+
+    if (_heap.size() < _count)
+    {
+        _heap.push_back(std::move(data));
+
+        std::push_heap(_heap.begin(), _heap.end(), inverse);
+    }
+    else
+    {
+        _heap[0] = std::move(data);
+
+        detail::sift_down(_heap.begin(), _heap.size(), 0, inverse);
+    }
+
+    return true;
+}
+
+template<typename T, typename Compare>
+const T& Dataplex::TopK<T, Compare>::threshold() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No element exists in the top k!");
     }
 
-    std::pop_heap(_array.begin(), _array.end(), cmp); 
-    _array.pop_back();
+    return _heap[0];
+}
+
+template<typename T, typename Compare>
+Dataplex::DynamicArray<T> Dataplex::TopK<T, Compare>::sorted() const
+{
+    auto result = _heap;
+
+    std::sort(result.begin(), result.end(), detail::InverseCompare<Compare>{ _comp });
+
+    return result;
 }
 
-template<typename T, typename Comp>
-std::size_t Dataplex::PriorityQueue<T, Comp>::size() const
+template<typename T, typename Compare>
+Dataplex::DynamicArray<T> Dataplex::TopK<T, Compare>::take()
 {
-    return _array.size();
+    auto result = std::move(_heap);
+
+    _heap = DynamicArray<T>(_count);
+
+    std::sort(result.begin(), result.end(), detail::InverseCompare<Compare>{ _comp });
+
+    return result;
 }
 
-template<typename T, typename Comp>
-bool Dataplex::PriorityQueue<T, Comp>::is_empty() const
+template<typename T, typename Compare>
+void Dataplex::TopK<T, Compare>::clear()
 {
-    return _array.is_empty();
-}
\ No newline at end of file
+    _heap = DynamicArray<T>(_count);
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::TopK<T, Compare>::size() const
+{
+    return _heap.size();
+}
+
+template<typename T, typename Compare>
+std::size_t Dataplex::TopK<T, Compare>::capacity() const
+{
+    return _count;
+}
+
+template<typename T, typename Compare>
+bool Dataplex::TopK<T, Compare>::is_empty() const
+{
+    return _heap.is_empty();
+}
+
+template<typename T, typename Compare>
+bool Dataplex::TopK<T, Compare>::is_full() const
+{
+    return _heap.size() == _count;
+}
+
+template<typename T, typename Compare>
+bool Dataplex::TopK<T, Compare>::admits(const T& data) const
+{
+    return _heap.size() < _count || (_count > 0 && _comp(_heap[0], data));
+}
+
+template<typename Range, typename Compare>
+auto Dataplex::top_k(const Range& range, std::size_t count, Compare comp)
+{
+    using Iterator = decltype(std::begin(range));
+    using T = std::decay_t<decltype(*std::begin(range))>;
+
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value)
+    {
+        auto size = static_cast<std::size_t>(std::end(range) - std::begin(range));
+
+        if (count * 8 >= size)
+        {
+            DynamicArray<T> result(size);
+
+            for (const auto& data : range)
+            {
+                result.push_back(data);
+            }
+
+            count = std::min(count, size);
+
+            std::partial_sort(result.begin(), result.begin() + count, result.end(), detail::InverseCompare<Compare>{ comp });
+
+            while (result.size() > count)
+            {
+                result.pop_back();
+            }
+
+            return result;
+        }
+    }
+
+    TopK<T, Compare> accumulator(count, comp);
+
+    for (const auto& data : range)
+    {
+        accumulator.push(data);
+    }
+
+    return accumulator.take();
+}
@@ -7,12 +7,15 @@ http://inversepalindrome.com
 
 #pragma once
 
-#include "DynamicArray.hpp"
+#include "Deque.hpp"
+
+#include <utility>
+#include <stdexcept>
 
 
 namespace Dataplex
 {
-    template<typename T>
+    template<typename T, typename Container = Deque<T>>
     class Queue
     {
     public:
@@ -20,63 +23,119 @@ namespace Dataplex
         const T& front() const;
 
         void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
         void pop();
+        T pop_value();
+        bool try_pop(T& data);
+
+        const Container& container() const;
 
         std::size_t size() const;
         bool is_empty() const;
 
     private:
-        DynamicArray<T> _array;
+        Container _container;
     };
 }
 
-template<typename T>
-T& Dataplex::Queue<T>::front()
+template<typename T, typename Container>
+T& Dataplex::Queue<T, Container>::front()
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the queue!");
     }
 
-    return _array[0];
+    return _container.head();
 }
 
-template<typename T>
-const T& Dataplex::Queue<T>::front() const
+template<typename T, typename Container>
+const T& Dataplex::Queue<T, Container>::front() const
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the queue!");
     }
 
-    return _array[0];
+    return _container.head();
+}
+
+template<typename T, typename Container>
+void Dataplex::Queue<T, Container>::push(const T& data)
+{
+    _container.push_back(data);
+}
+
+template<typename T, typename Container>
+void Dataplex::Queue<T, Container>::push(T&& data)
+{
+    _container.push_back(std::move(data));
 }
 
-template<typename T>
-void Dataplex::Queue<T>::push(const T& data)
+template<typename T, typename Container>
+template<typename... Args>
+void Dataplex::Queue<T, Container>::emplace(Args&&... args)
 {
-    _array.push_back(data);
+    _container.emplace_back(std::forward<Args>(args)...);
 }
 
-template<typename T>
-void Dataplex::Queue<T>::pop()
+template<typename T, typename Container>
+void Dataplex::Queue<T, Container>::pop()
 {
     if (is_empty())
     {
         throw std::out_of_range("Can't pop empty queue!");
     }
 
-    _array.erase(0);
+    _container.pop_front();
 }
 
-template<typename T>
-std::size_t Dataplex::Queue<T>::size() const
+template<typename T, typename Container>
+T Dataplex::Queue<T, Container>::pop_value()
 {
-    return _array.size();
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop empty queue!");
+    }
+
+    T data = std::move(_container.head());
+    _container.pop_front();
+
+    return data;
 }
 
-template<typename T>
-bool Dataplex::Queue<T>::is_empty() const
+template<typename T, typename Container>
+bool Dataplex::Queue<T, Container>::try_pop(T& data)
 {
-    return _array.is_empty();
-}
\ No newline at end of file
+    if (is_empty())
+    {
+        return false;
+    }
+
+    data = std::move(_container.head());
+    _container.pop_front();
+
+    return true;
+}
+
+template<typename T, typename Container>
+const Container& Dataplex::Queue<T, Container>::container() const
+{
+    return _container;
+}
+
+template<typename T, typename Container>
+std::size_t Dataplex::Queue<T, Container>::size() const
+{
+    return _container.size();
+}
+
+template<typename T, typename Container>
+bool Dataplex::Queue<T, Container>::is_empty() const
+{
+    return _container.is_empty();
+}
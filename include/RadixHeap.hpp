@@ -0,0 +1,268 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - RadixHeap.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "StaticArray.hpp"
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace Dataplex
+{
+    template<typename Key, typename T>
+    class RadixHeap
+    {
+        static_assert(std::is_unsigned<Key>::value, "Radix heap keys must be unsigned integers!");
+        static_assert(std::numeric_limits<Key>::digits <= 64, "Radix heap keys must fit in 64 bits!");
+
+    public:
+        RadixHeap();
+
+        T& front();
+        Key front_key();
+
+        void push(Key key, const T& data);
+        void push(Key key, T&& data);
+
+        template<typename... Args>
+        void emplace(Key key, Args&&... args);
+
+        void pop();
+        T pop_value();
+        bool try_pop(Key& key, T& data);
+
+        void clear();
+
+        Key last_key() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t KeyBits = std::numeric_limits<Key>::digits;
+
+        struct Entry
+        {
+            Key key;
+            T data;
+        };
+
+        StaticArray<DynamicArray<Entry>, KeyBits + 1> _buckets;
+        std::uint64_t _occupied;
+
+        Key _last;
+        std::size_t _size;
+
+        void insert(Entry&& entry);
+        void refill();
+
+        std::size_t bucket_of(Key key) const;
+    };
+}
+
+template<typename Key, typename T>
+Dataplex::RadixHeap<Key, T>::RadixHeap() :
+    _buckets(),
+    _occupied(0),
+    _last(0),
+    _size(0)
+{
+}
+
+template<typename Key, typename T>
+T& Dataplex::RadixHeap<Key, T>::front()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No element exists in the radix heap!");
+    }
+
+    refill();
+
+    return _buckets[0].tail().data;
+}
+
+template<typename Key, typename T>
+Key Dataplex::RadixHeap<Key, T>::front_key()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("No element exists in the radix heap!");
+    }
+
+    refill();
+
+    return _last;
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::push(Key key, const T& data)
+{
+    insert(Entry{ key, data });
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::push(Key key, T&& data)
+{
+    insert(Entry{ key, std::move(data) });
+}
+
+template<typename Key, typename T>
+template<typename... Args>
+void Dataplex::RadixHeap<Key, T>::emplace(Key key, Args&&... args)
+{
+    insert(Entry{ key, T(std::forward<Args>(args)...) });
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::pop()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop empty radix heap!");
+    }
+
+    refill();
+
+    _buckets[0].pop_back();
+
+    --_size;
+}
+
+template<typename Key, typename T>
+T Dataplex::RadixHeap<Key, T>::pop_value()
+{
+    auto data = std::move(front());
+
+    pop();
+
+    return data;
+}
+
+template<typename Key, typename T>
+bool Dataplex::RadixHeap<Key, T>::try_pop(Key& key, T& data)
+{
+    if (is_empty())
+    {
+        return false;
+    }
+
+    key = front_key();
+    data = pop_value();
+
+    return true;
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::clear()
+{
+    for (auto& bucket : _buckets)
+    {
+        bucket.clear();
+    }
+
+    _occupied = 0;
+    _last = 0;
+    _size = 0;
+}
+
+template<typename Key, typename T>
+Key Dataplex::RadixHeap<Key, T>::last_key() const
+{
+    return _last;
+}
+
+template<typename Key, typename T>
+std::size_t Dataplex::RadixHeap<Key, T>::size() const
+{
+    return _size;
+}
+
+template<typename Key, typename T>
+bool Dataplex::RadixHeap<Key, T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::insert(Entry&& entry)
+{
+    if (entry.key < _last)
+    {
+        throw std::invalid_argument("Radix heap key is less than the last extracted key!");
+    }
+
+    auto bucket = bucket_of(entry.key);
+
+    _buckets[bucket].push_back(std::move(entry));
+
+    if (bucket > 0)
+    {
+        _occupied |= std::uint64_t(1) << (bucket - 1);
+    }
+
+    ++_size;
+}
+
+template<typename Key, typename T>
+void Dataplex::RadixHeap<Key, T>::refill()
+{
+    if (!_buckets[0].is_empty())
+    {
+        return;
+    }
+
+    auto index = static_cast<std::size_t>(detail::count_trailing_zeros(_occupied)) + 1;
+    auto& source = _buckets[index];
+
+    auto last = source[0].key;
+
+    for (const auto& entry : source)
+    {
+        if (entry.key < last)
+        {
+            last = entry.key;
+        }
+    }
+
+    _last = last;
+
+    for (auto& entry : source)
+    {
+        auto bucket = bucket_of(entry.key);
+
+        _buckets[bucket].push_back(std::move(entry));
+
+        if (bucket > 0)
+        {
+            _occupied |= std::uint64_t(1) << (bucket - 1);
+        }
+    }
+
+    source.resize(0);
+
+    _occupied &= ~(std::uint64_t(1) << (index - 1));
+}
+
+template<typename Key, typename T>
+std::size_t Dataplex::RadixHeap<Key, T>::bucket_of(Key key) const
+{
+    if (key == _last)
+    {
+        return 0;
+    }
+
+    return 64 - static_cast<std::size_t>(detail::count_leading_zeros(static_cast<std::uint64_t>(key ^ _last)));
+}
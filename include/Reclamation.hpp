@@ -0,0 +1,690 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Reclamation.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+
+namespace Dataplex
+{
+    class EpochManager
+    {
+    public:
+        EpochManager();
+        EpochManager(const EpochManager& manager) = delete;
+        EpochManager& operator=(const EpochManager& manager) = delete;
+
+        ~EpochManager();
+
+        static EpochManager& global();
+
+        void pin();
+        void unpin();
+
+        template<typename T>
+        void retire(T* pointer);
+        void retire(void* pointer, void (*deleter)(void*));
+
+        void collect();
+
+        std::uint64_t epoch() const;
+
+    private:
+        static constexpr std::size_t CollectInterval = 64;
+
+        struct Retired
+        {
+            void* pointer;
+            void (*deleter)(void*);
+        };
+
+        struct Record
+        {
+            Record();
+
+            std::atomic<std::uint64_t> epoch;
+            std::atomic<bool> used;
+            Record* next;
+            std::size_t nesting;
+            std::size_t retireCount;
+            std::uint64_t binEpochs[3];
+            DynamicArray<Retired> bins[3];
+        };
+
+        struct Entry
+        {
+            EpochManager* manager;
+            std::uint64_t id;
+            Record* record;
+        };
+
+        class ThreadCache
+        {
+        public:
+            ThreadCache() = default;
+            ThreadCache(const ThreadCache& cache) = delete;
+            ThreadCache& operator=(const ThreadCache& cache) = delete;
+
+            ~ThreadCache();
+
+            DynamicArray<Entry> entries;
+        };
+
+        std::atomic<std::uint64_t> _epoch;
+        std::atomic<Record*> _records;
+        std::uint64_t _id;
+
+        Record& record();
+        Record* acquire_record();
+        void release_record(Record& record);
+
+        bool try_advance();
+        void collect(Record& record);
+
+        static void free_bin(DynamicArray<Retired>& bin);
+
+        template<typename T>
+        static void delete_object(void* pointer);
+
+        static ThreadCache& thread_cache();
+        static std::mutex& registry_mutex();
+        static DynamicArray<std::uint64_t>& registry();
+    };
+
+    class EpochGuard
+    {
+    public:
+        explicit EpochGuard(EpochManager& manager = EpochManager::global());
+        EpochGuard(const EpochGuard& guard);
+        EpochGuard& operator=(const EpochGuard& guard);
+
+        ~EpochGuard();
+
+    private:
+        EpochManager* _manager;
+    };
+
+    class HazardPointerDomain
+    {
+    public:
+        HazardPointerDomain();
+        HazardPointerDomain(const HazardPointerDomain& domain) = delete;
+        HazardPointerDomain& operator=(const HazardPointerDomain& domain) = delete;
+
+        ~HazardPointerDomain();
+
+        static HazardPointerDomain& global();
+
+        template<typename T>
+        void retire(T* pointer);
+        void retire(void* pointer, void (*deleter)(void*));
+
+        void collect();
+
+        std::size_t retired_count() const;
+
+    private:
+        friend class HazardPointer;
+
+        static constexpr std::size_t MinimumThreshold = 64;
+
+        struct Slot
+        {
+            Slot();
+
+            std::atomic<const void*> hazard;
+            std::atomic<bool> used;
+            Slot* next;
+        };
+
+        struct Retired
+        {
+            void* pointer;
+            void (*deleter)(void*);
+            Retired* next;
+        };
+
+        std::atomic<Slot*> _slots;
+        std::atomic<std::size_t> _slotCount;
+        std::atomic<Retired*> _retired;
+        std::atomic<std::size_t> _retiredCount;
+
+        Slot* acquire_slot();
+        void release_slot(Slot* slot);
+
+        void push_retired(Retired* first, Retired* last, std::size_t count);
+
+        template<typename T>
+        static void delete_object(void* pointer);
+    };
+
+    class HazardPointer
+    {
+    public:
+        explicit HazardPointer(HazardPointerDomain& domain = HazardPointerDomain::global());
+        HazardPointer(const HazardPointer& hazard) = delete;
+        HazardPointer& operator=(const HazardPointer& hazard) = delete;
+
+        ~HazardPointer();
+
+        template<typename T>
+        T* protect(const std::atomic<T*>& source);
+
+        void reset();
+
+    private:
+        HazardPointerDomain& _domain;
+        HazardPointerDomain::Slot* _slot;
+    };
+}
+
+inline Dataplex::EpochManager::EpochManager() :
+    _epoch(0),
+    _records(nullptr)
+{
+    static std::atomic<std::uint64_t> nextId(0);
+
+    _id = nextId.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(registry_mutex());
+
+    registry().push_back(_id);
+}
+
+inline Dataplex::EpochManager::~EpochManager()
+{
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+
+        auto& ids = registry();
+
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            if (ids[i] == _id)
+            {
+                ids.erase(i);
+
+                break;
+            }
+        }
+    }
+
+    auto record = _records.load();
+
+    while (record)
+    {
+        auto next = record->next;
+
+        for (auto& bin : record->bins)
+        {
+            free_bin(bin);
+        }
+
+        delete record;
+        record = next;
+    }
+}
+
+inline Dataplex::EpochManager& Dataplex::EpochManager::global()
+{
+    static EpochManager manager;
+
+    return manager;
+}
+
+inline void Dataplex::EpochManager::pin()
+{
+    auto& current = record();
+
+    if (current.nesting++ == 0)
+    {
+        current.epoch.store((_epoch.load() << 1) | 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+inline void Dataplex::EpochManager::unpin()
+{
+    auto& current = record();
+
+    if (--current.nesting == 0)
+    {
+        current.epoch.store(current.epoch.load(std::memory_order_relaxed) & ~std::uint64_t(1), std::memory_order_release);
+    }
+}
+
+template<typename T>
+void Dataplex::EpochManager::retire(T* pointer)
+{
+    retire(pointer, &delete_object<T>);
+}
+
+inline void Dataplex::EpochManager::retire(void* pointer, void (*deleter)(void*))
+{
+    auto& current = record();
+    auto epoch = _epoch.load();
+    auto& bin = current.bins[epoch % 3];
+
+    if (current.binEpochs[epoch % 3] != epoch)
+    {
+        free_bin(bin);
+        current.binEpochs[epoch % 3] = epoch;
+    }
+
+    bin.push_back({ pointer, deleter });
+
+    if (++current.retireCount % CollectInterval == 0)
+    {
+        try_advance();
+        collect(current);
+    }
+}
+
+inline void Dataplex::EpochManager::collect()
+{
+    try_advance();
+    collect(record());
+}
+
+inline std::uint64_t Dataplex::EpochManager::epoch() const
+{
+    return _epoch.load();
+}
+
+inline Dataplex::EpochManager::Record::Record() :
+    epoch(0),
+    used(true),
+    next(nullptr),
+    nesting(0),
+    retireCount(0),
+    binEpochs{ 0, 0, 0 }
+{
+}
+
+inline Dataplex::EpochManager::ThreadCache::~ThreadCache()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+
+    const auto& ids = registry();
+
+    for (const auto& entry : entries)
+    {
+        if (std::find(ids.begin(), ids.end(), entry.id) != ids.end())
+        {
+            entry.manager->release_record(*entry.record);
+        }
+    }
+}
+
+inline Dataplex::EpochManager::Record& Dataplex::EpochManager::record()
+{
+    auto& entries = thread_cache().entries;
+
+    for (const auto& entry : entries)
+    {
+        if (entry.id == _id)
+        {
+            return *entry.record;
+        }
+    }
+
+    auto record = acquire_record();
+
+    entries.push_back({ this, _id, record });
+
+    return *record;
+}
+
+inline Dataplex::EpochManager::Record* Dataplex::EpochManager::acquire_record()
+{
+    for (auto record = _records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        auto used = false;
+
+        if (!record->used.load(std::memory_order_relaxed) &&
+            record->used.compare_exchange_strong(used, true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto record = new Record();
+    auto head = _records.load(std::memory_order_relaxed);
+
+    do
+    {
+        record->next = head;
+    } while (!_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    return record;
+}
+
+inline void Dataplex::EpochManager::release_record(Record& record)
+{
+    try_advance();
+    collect(record);
+
+    record.used.store(false, std::memory_order_release);
+}
+
+inline bool Dataplex::EpochManager::try_advance()
+{
+    auto epoch = _epoch.load();
+
+    for (auto record = _records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        auto state = record->epoch.load();
+
+        if ((state & 1) && (state >> 1) != epoch)
+        {
+            return false;
+        }
+    }
+
+    return _epoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void Dataplex::EpochManager::collect(Record& record)
+{
+    auto epoch = _epoch.load();
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        if (record.binEpochs[i] + 2 <= epoch)
+        {
+            free_bin(record.bins[i]);
+        }
+    }
+}
+
+inline void Dataplex::EpochManager::free_bin(DynamicArray<Retired>& bin)
+{
+    for (const auto& retired : bin)
+    {
+        retired.deleter(retired.pointer);
+    }
+
+    bin.clear();
+}
+
+template<typename T>
+void Dataplex::EpochManager::delete_object(void* pointer)
+{
+    delete static_cast<T*>(pointer);
+}
+
+inline Dataplex::EpochManager::ThreadCache& Dataplex::EpochManager::thread_cache()
+{
+    static thread_local ThreadCache cache;
+
+    return cache;
+}
+
+inline std::mutex& Dataplex::EpochManager::registry_mutex()
+{
+    static std::mutex mutex;
+
+    return mutex;
+}
+
+inline Dataplex::DynamicArray<std::uint64_t>& Dataplex::EpochManager::registry()
+{
+    static DynamicArray<std::uint64_t> ids;
+
+    return ids;
+}
+
+inline Dataplex::EpochGuard::EpochGuard(EpochManager& manager) :
+    _manager(&manager)
+{
+    _manager->pin();
+}
+
+inline Dataplex::EpochGuard::EpochGuard(const EpochGuard& guard) :
+    _manager(guard._manager)
+{
+    _manager->pin();
+}
+
+inline Dataplex::EpochGuard& Dataplex::EpochGuard::operator=(const EpochGuard& guard)
+{
+    guard._manager->pin();
+    _manager->unpin();
+    _manager = guard._manager;
+
+    return *this;
+}
+
+inline Dataplex::EpochGuard::~EpochGuard()
+{
+    _manager->unpin();
+}
+
+inline Dataplex::HazardPointerDomain::HazardPointerDomain() :
+    _slots(nullptr),
+    _slotCount(0),
+    _retired(nullptr),
+    _retiredCount(0)
+{
+}
+
+inline Dataplex::HazardPointerDomain::~HazardPointerDomain()
+{
+    auto retired = _retired.load();
+
+    while (retired)
+    {
+        auto next = retired->next;
+
+        retired->deleter(retired->pointer);
+        delete retired;
+
+        retired = next;
+    }
+
+    auto slot = _slots.load();
+
+    while (slot)
+    {
+        auto next = slot->next;
+
+        delete slot;
+        slot = next;
+    }
+}
+
+inline Dataplex::HazardPointerDomain& Dataplex::HazardPointerDomain::global()
+{
+    static HazardPointerDomain domain;
+
+    return domain;
+}
+
+template<typename T>
+void Dataplex::HazardPointerDomain::retire(T* pointer)
+{
+    retire(pointer, &delete_object<T>);
+}
+
+inline void Dataplex::HazardPointerDomain::retire(void* pointer, void (*deleter)(void*))
+{
+    auto retired = new Retired{ pointer, deleter, nullptr };
+
+    push_retired(retired, retired, 1);
+
+    auto threshold = std::max(2 * _slotCount.load(std::memory_order_relaxed), MinimumThreshold);
+
+    if (_retiredCount.load(std::memory_order_relaxed) >= threshold)
+    {
+        collect();
+    }
+}
+
+inline void Dataplex::HazardPointerDomain::collect()
+{
+    auto retired = _retired.exchange(nullptr, std::memory_order_acquire);
+
+    if (!retired)
+    {
+        return;
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    DynamicArray<const void*> hazards;
+
+    for (auto slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next)
+    {
+        auto hazard = slot->hazard.load();
+
+        if (hazard)
+        {
+            hazards.push_back(hazard);
+        }
+    }
+
+    std::sort(hazards.begin(), hazards.end());
+
+    Retired* keptFirst = nullptr;
+    Retired* keptLast = nullptr;
+    std::size_t freed = 0;
+    std::size_t kept = 0;
+
+    while (retired)
+    {
+        auto next = retired->next;
+
+        if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(retired->pointer)))
+        {
+            retired->next = keptFirst;
+            keptFirst = retired;
+            keptLast = keptLast ? keptLast : retired;
+            ++kept;
+        }
+        else
+        {
+            retired->deleter(retired->pointer);
+            delete retired;
+            ++freed;
+        }
+
+        retired = next;
+    }
+
+    _retiredCount.fetch_sub(freed + kept, std::memory_order_relaxed);
+
+    if (keptFirst)
+    {
+        push_retired(keptFirst, keptLast, kept);
+    }
+}
+
+inline std::size_t Dataplex::HazardPointerDomain::retired_count() const
+{
+    return _retiredCount.load(std::memory_order_relaxed);
+}
+
+inline Dataplex::HazardPointerDomain::Slot::Slot() :
+    hazard(nullptr),
+    used(true),
+    next(nullptr)
+{
+}
+
+inline Dataplex::HazardPointerDomain::Slot* Dataplex::HazardPointerDomain::acquire_slot()
+{
+    for (auto slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next)
+    {
+        auto used = false;
+
+        if (!slot->used.load(std::memory_order_relaxed) &&
+            slot->used.compare_exchange_strong(used, true, std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+
+    auto slot = new Slot();
+    auto head = _slots.load(std::memory_order_relaxed);
+
+    do
+    {
+        slot->next = head;
+    } while (!_slots.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+
+    _slotCount.fetch_add(1, std::memory_order_relaxed);
+
+    return slot;
+}
+
+inline void Dataplex::HazardPointerDomain::release_slot(Slot* slot)
+{
+    slot->hazard.store(nullptr, std::memory_order_release);
+    slot->used.store(false, std::memory_order_release);
+}
+
+inline void Dataplex::HazardPointerDomain::push_retired(Retired* first, Retired* last, std::size_t count)
+{
+    _retiredCount.fetch_add(count, std::memory_order_relaxed);
+
+    auto head = _retired.load(std::memory_order_relaxed);
+
+    do
+    {
+        last->next = head;
+    } while (!_retired.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<typename T>
+void Dataplex::HazardPointerDomain::delete_object(void* pointer)
+{
+    delete static_cast<T*>(pointer);
+}
+
+inline Dataplex::HazardPointer::HazardPointer(HazardPointerDomain& domain) :
+    _domain(domain),
+    _slot(domain.acquire_slot())
+{
+}
+
+inline Dataplex::HazardPointer::~HazardPointer()
+{
+    _domain.release_slot(_slot);
+}
+
+template<typename T>
+T* Dataplex::HazardPointer::protect(const std::atomic<T*>& source)
+{
+    auto pointer = source.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        _slot->hazard.store(pointer, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto current = source.load(std::memory_order_acquire);
+
+        if (current == pointer)
+        {
+            return pointer;
+        }
+
+        pointer = current;
+    }
+}
+
+inline void Dataplex::HazardPointer::reset()
+{
+    _slot->hazard.store(nullptr, std::memory_order_release);
+}
@@ -0,0 +1,889 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - RoaringBitmap.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "StaticBitset.hpp"
+#include "BitOperations.hpp"
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    class RoaringBitmap
+    {
+    public:
+        RoaringBitmap();
+        RoaringBitmap(std::initializer_list<std::uint32_t> list);
+
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        void add(std::uint32_t value);
+        bool remove(std::uint32_t value);
+        bool contains(std::uint32_t value) const;
+
+        RoaringBitmap& operator&=(const RoaringBitmap& bitmap);
+        RoaringBitmap& operator|=(const RoaringBitmap& bitmap);
+        RoaringBitmap& operator^=(const RoaringBitmap& bitmap);
+        RoaringBitmap& and_not(const RoaringBitmap& bitmap);
+
+        bool operator==(const RoaringBitmap& bitmap) const;
+        bool operator!=(const RoaringBitmap& bitmap) const;
+
+        void run_optimize();
+        void clear();
+
+        std::size_t cardinality() const;
+        std::size_t size_in_bytes() const;
+        bool is_empty() const;
+
+    private:
+        using Bitmap = StaticBitset<65536>;
+
+        enum class Type : std::uint8_t
+        {
+            Array,
+            Bitmap,
+            Run
+        };
+
+        struct Container
+        {
+            Container();
+            Container(const Container& container);
+            Container& operator=(const Container& container);
+            Container(Container&& container) = default;
+            Container& operator=(Container&& container) = default;
+
+            Type type;
+            std::uint32_t cardinality;
+            DynamicArray<std::uint16_t> values;
+            std::unique_ptr<Bitmap> bitmap;
+        };
+
+        static constexpr std::uint32_t ArrayLimit = 4096;
+
+        DynamicArray<std::uint16_t> _keys;
+        DynamicArray<Container> _containers;
+
+        std::size_t find_container(std::uint16_t key) const;
+
+        static bool container_add(Container& container, std::uint16_t value);
+        static bool container_remove(Container& container, std::uint16_t value);
+        static bool container_contains(const Container& container, std::uint16_t value);
+        static bool container_equals(const Container& left, const Container& right);
+
+        template<detail::BitOperation Operation>
+        static Container combine(const Container& left, const Container& right);
+
+        template<detail::BitOperation Operation>
+        static Container combine_arrays(const Container& left, const Container& right);
+
+        template<typename F>
+        static void for_each_value(const Container& container, F&& f);
+
+        static std::unique_ptr<Bitmap> make_bitmap(const Container& container);
+        static void to_array(Container& container);
+        static void to_bitmap(Container& container);
+        static void expand(Container& container);
+        static void normalize(Container& container);
+        static std::size_t count_runs(const Container& container);
+
+        template<detail::BitOperation Operation>
+        RoaringBitmap& combine(const RoaringBitmap& bitmap);
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using value_type = std::uint32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::uint32_t*;
+            using reference = std::uint32_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            ConstIterator();
+            ConstIterator(const RoaringBitmap* bitmap, std::size_t container);
+
+            std::uint32_t operator*() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const RoaringBitmap* _bitmap;
+            std::size_t _container;
+            std::size_t _index;
+            std::uint32_t _value;
+
+            void load_container();
+        };
+    };
+
+    RoaringBitmap operator&(RoaringBitmap left, const RoaringBitmap& right);
+    RoaringBitmap operator|(RoaringBitmap left, const RoaringBitmap& right);
+    RoaringBitmap operator^(RoaringBitmap left, const RoaringBitmap& right);
+}
+
+inline Dataplex::RoaringBitmap::RoaringBitmap()
+{
+}
+
+inline Dataplex::RoaringBitmap::RoaringBitmap(std::initializer_list<std::uint32_t> list)
+{
+    for (auto value : list)
+    {
+        add(value);
+    }
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator Dataplex::RoaringBitmap::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator Dataplex::RoaringBitmap::end() const
+{
+    return ConstIterator(this, _containers.size());
+}
+
+inline void Dataplex::RoaringBitmap::add(std::uint32_t value)
+{
+    auto key = static_cast<std::uint16_t>(value >> 16);
+    auto pos = find_container(key);
+
+    if (pos == _keys.size() || _keys[pos] != key)
+    {
+        _keys.insert(key, pos);
+        _containers.insert(Container(), pos);
+    }
+
+    container_add(_containers[pos], static_cast<std::uint16_t>(value));
+}
+
+inline bool Dataplex::RoaringBitmap::remove(std::uint32_t value)
+{
+    auto key = static_cast<std::uint16_t>(value >> 16);
+    auto pos = find_container(key);
+
+    if (pos == _keys.size() || _keys[pos] != key || !container_remove(_containers[pos], static_cast<std::uint16_t>(value)))
+    {
+        return false;
+    }
+
+    if (_containers[pos].cardinality == 0)
+    {
+        _keys.erase(pos);
+        _containers.erase(pos);
+    }
+
+    return true;
+}
+
+inline bool Dataplex::RoaringBitmap::contains(std::uint32_t value) const
+{
+    auto key = static_cast<std::uint16_t>(value >> 16);
+    auto pos = find_container(key);
+
+    return pos < _keys.size() && _keys[pos] == key && container_contains(_containers[pos], static_cast<std::uint16_t>(value));
+}
+
+inline Dataplex::RoaringBitmap& Dataplex::RoaringBitmap::operator&=(const RoaringBitmap& bitmap)
+{
+    return combine<detail::BitOperation::And>(bitmap);
+}
+
+inline Dataplex::RoaringBitmap& Dataplex::RoaringBitmap::operator|=(const RoaringBitmap& bitmap)
+{
+    return combine<detail::BitOperation::Or>(bitmap);
+}
+
+inline Dataplex::RoaringBitmap& Dataplex::RoaringBitmap::operator^=(const RoaringBitmap& bitmap)
+{
+    return combine<detail::BitOperation::Xor>(bitmap);
+}
+
+inline Dataplex::RoaringBitmap& Dataplex::RoaringBitmap::and_not(const RoaringBitmap& bitmap)
+{
+    return combine<detail::BitOperation::AndNot>(bitmap);
+}
+
+inline bool Dataplex::RoaringBitmap::operator==(const RoaringBitmap& bitmap) const
+{
+    if (_keys.size() != bitmap._keys.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < _keys.size(); ++i)
+    {
+        if (_keys[i] != bitmap._keys[i] || !container_equals(_containers[i], bitmap._containers[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool Dataplex::RoaringBitmap::operator!=(const RoaringBitmap& bitmap) const
+{
+    return !(*this == bitmap);
+}
+
+inline void Dataplex::RoaringBitmap::run_optimize()
+{
+    for (auto& container : _containers)
+    {
+        if (container.type == Type::Run)
+        {
+            continue;
+        }
+
+        auto runs = count_runs(container);
+        auto size = container.type == Type::Array ? container.cardinality * sizeof(std::uint16_t) : sizeof(Bitmap);
+
+        if (runs * 2 * sizeof(std::uint16_t) >= size)
+        {
+            continue;
+        }
+
+        DynamicArray<std::uint16_t> values(runs * 2);
+        std::uint32_t start = 0;
+        std::uint32_t previous = 0;
+        bool first = true;
+
+        for_each_value(container, [&](std::uint16_t value)
+        {
+            if (first || value != previous + 1)
+            {
+                if (!first)
+                {
+                    values.push_back(static_cast<std::uint16_t>(start));
+                    values.push_back(static_cast<std::uint16_t>(previous - start));
+                }
+
+                start = value;
+                first = false;
+            }
+
+            previous = value;
+        });
+
+        values.push_back(static_cast<std::uint16_t>(start));
+        values.push_back(static_cast<std::uint16_t>(previous - start));
+
+        container.type = Type::Run;
+        container.values = std::move(values);
+        container.bitmap.reset();
+    }
+}
+
+inline void Dataplex::RoaringBitmap::clear()
+{
+    _keys.clear();
+    _containers.clear();
+}
+
+inline std::size_t Dataplex::RoaringBitmap::cardinality() const
+{
+    std::size_t cardinality = 0;
+
+    for (const auto& container : _containers)
+    {
+        cardinality += container.cardinality;
+    }
+
+    return cardinality;
+}
+
+inline std::size_t Dataplex::RoaringBitmap::size_in_bytes() const
+{
+    auto size = sizeof(RoaringBitmap) + _keys.capacity() * sizeof(std::uint16_t) + _containers.capacity() * sizeof(Container);
+
+    for (const auto& container : _containers)
+    {
+        size += container.values.capacity() * sizeof(std::uint16_t);
+
+        if (container.bitmap)
+        {
+            size += sizeof(Bitmap);
+        }
+    }
+
+    return size;
+}
+
+inline bool Dataplex::RoaringBitmap::is_empty() const
+{
+    return _containers.is_empty();
+}
+
+inline Dataplex::RoaringBitmap::Container::Container() :
+    type(Type::Array),
+    cardinality(0)
+{
+}
+
+inline Dataplex::RoaringBitmap::Container::Container(const Container& container) :
+    type(container.type),
+    cardinality(container.cardinality),
+    values(container.values),
+    bitmap(container.bitmap ? std::make_unique<Bitmap>(*container.bitmap) : nullptr)
+{
+}
+
+inline Dataplex::RoaringBitmap::Container& Dataplex::RoaringBitmap::Container::operator=(const Container& container)
+{
+    Container temp(container);
+    *this = std::move(temp);
+
+    return *this;
+}
+
+inline std::size_t Dataplex::RoaringBitmap::find_container(std::uint16_t key) const
+{
+    return static_cast<std::size_t>(std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin());
+}
+
+inline bool Dataplex::RoaringBitmap::container_add(Container& container, std::uint16_t value)
+{
+    expand(container);
+
+    if (container.type == Type::Bitmap)
+    {
+        if ((*container.bitmap)[value])
+        {
+            return false;
+        }
+
+        container.bitmap->set(value);
+    }
+    else
+    {
+        auto pos = std::lower_bound(container.values.begin(), container.values.end(), value);
+
+        if (pos != container.values.end() && *pos == value)
+        {
+            return false;
+        }
+
+        container.values.insert(value, static_cast<std::size_t>(pos - container.values.begin()));
+    }
+
+    ++container.cardinality;
+    normalize(container);
+
+    return true;
+}
+
+inline bool Dataplex::RoaringBitmap::container_remove(Container& container, std::uint16_t value)
+{
+    if (!container_contains(container, value))
+    {
+        return false;
+    }
+
+    expand(container);
+
+    if (container.type == Type::Bitmap)
+    {
+        container.bitmap->reset(value);
+    }
+    else
+    {
+        auto pos = std::lower_bound(container.values.begin(), container.values.end(), value);
+
+        container.values.erase(static_cast<std::size_t>(pos - container.values.begin()));
+    }
+
+    --container.cardinality;
+    normalize(container);
+
+    return true;
+}
+
+inline bool Dataplex::RoaringBitmap::container_contains(const Container& container, std::uint16_t value)
+{
+    if (container.type == Type::Array)
+    {
+        return std::binary_search(container.values.begin(), container.values.end(), value);
+    }
+    else if (container.type == Type::Bitmap)
+    {
+        return (*container.bitmap)[value];
+    }
+
+    std::size_t low = 0;
+    std::size_t high = container.values.size() / 2;
+
+    while (low < high)
+    {
+        auto middle = (low + high) / 2;
+
+        if (container.values[middle * 2] <= value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low > 0 && value - container.values[(low - 1) * 2] <= container.values[(low - 1) * 2 + 1];
+}
+
+inline bool Dataplex::RoaringBitmap::container_equals(const Container& left, const Container& right)
+{
+    if (left.cardinality != right.cardinality)
+    {
+        return false;
+    }
+    else if (left.type == right.type && left.type != Type::Bitmap)
+    {
+        return std::equal(left.values.begin(), left.values.end(), right.values.begin(), right.values.end());
+    }
+    else if (left.type == Type::Bitmap && right.type == Type::Bitmap)
+    {
+        return *left.bitmap == *right.bitmap;
+    }
+
+    return *make_bitmap(left) == *make_bitmap(right);
+}
+
+template<Dataplex::detail::BitOperation Operation>
+Dataplex::RoaringBitmap::Container Dataplex::RoaringBitmap::combine(const Container& left, const Container& right)
+{
+    if (left.type == Type::Array && right.type == Type::Array)
+    {
+        return combine_arrays<Operation>(left, right);
+    }
+
+    Container result;
+
+    if constexpr (Operation == detail::BitOperation::And || Operation == detail::BitOperation::AndNot)
+    {
+        const auto& filtered = Operation == detail::BitOperation::And && right.type == Type::Array ? right : left;
+        const auto& other = &filtered == &left ? right : left;
+
+        if (filtered.type == Type::Array)
+        {
+            for (auto value : filtered.values)
+            {
+                if (container_contains(other, value) == (Operation == detail::BitOperation::And))
+                {
+                    result.values.push_back(value);
+                }
+            }
+
+            result.cardinality = static_cast<std::uint32_t>(result.values.size());
+
+            return result;
+        }
+    }
+
+    result.type = Type::Bitmap;
+    result.bitmap = make_bitmap(left);
+
+    auto rightBitmap = right.type == Type::Bitmap ? nullptr : make_bitmap(right);
+    const auto& other = rightBitmap ? *rightBitmap : *right.bitmap;
+
+    if constexpr (Operation == detail::BitOperation::And)
+    {
+        *result.bitmap &= other;
+    }
+    else if constexpr (Operation == detail::BitOperation::Or)
+    {
+        *result.bitmap |= other;
+    }
+    else if constexpr (Operation == detail::BitOperation::Xor)
+    {
+        *result.bitmap ^= other;
+    }
+    else
+    {
+        result.bitmap->and_not(other);
+    }
+
+    result.cardinality = static_cast<std::uint32_t>(result.bitmap->count());
+    normalize(result);
+
+    return result;
+}
+
+template<Dataplex::detail::BitOperation Operation>
+Dataplex::RoaringBitmap::Container Dataplex::RoaringBitmap::combine_arrays(const Container& left, const Container& right)
+{
+    constexpr auto keepLeft = Operation != detail::BitOperation::And;
+    constexpr auto keepRight = Operation == detail::BitOperation::Or || Operation == detail::BitOperation::Xor;
+    constexpr auto keepBoth = Operation == detail::BitOperation::And || Operation == detail::BitOperation::Or;
+
+    Container result;
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    result.values.reserve(keepRight ? left.values.size() + right.values.size() : left.values.size());
+
+    while (i < left.values.size() && j < right.values.size())
+    {
+        if (left.values[i] < right.values[j])
+        {
+            if (keepLeft)
+            {
+                result.values.push_back(left.values[i]);
+            }
+
+            ++i;
+        }
+        else if (right.values[j] < left.values[i])
+        {
+            if (keepRight)
+            {
+                result.values.push_back(right.values[j]);
+            }
+
+            ++j;
+        }
+        else
+        {
+            if (keepBoth)
+            {
+                result.values.push_back(left.values[i]);
+            }
+
+            ++i;
+            ++j;
+        }
+    }
+
+    for (; keepLeft && i < left.values.size(); ++i)
+    {
+        result.values.push_back(left.values[i]);
+    }
+
+    for (; keepRight && j < right.values.size(); ++j)
+    {
+        result.values.push_back(right.values[j]);
+    }
+
+    result.cardinality = static_cast<std::uint32_t>(result.values.size());
+    normalize(result);
+
+    return result;
+}
+
+template<typename F>
+void Dataplex::RoaringBitmap::for_each_value(const Container& container, F&& f)
+{
+    if (container.type == Type::Array)
+    {
+        for (auto value : container.values)
+        {
+            f(value);
+        }
+    }
+    else if (container.type == Type::Bitmap)
+    {
+        for (auto value = container.bitmap->find_first(); value < container.bitmap->size(); value = container.bitmap->find_next(value))
+        {
+            f(static_cast<std::uint16_t>(value));
+        }
+    }
+    else
+    {
+        for (std::size_t run = 0; run < container.values.size(); run += 2)
+        {
+            std::uint32_t start = container.values[run];
+            std::uint32_t last = start + container.values[run + 1];
+
+            for (auto value = start; value <= last; ++value)
+            {
+                f(static_cast<std::uint16_t>(value));
+            }
+        }
+    }
+}
+
+inline std::unique_ptr<Dataplex::RoaringBitmap::Bitmap> Dataplex::RoaringBitmap::make_bitmap(const Container& container)
+{
+    if (container.type == Type::Bitmap)
+    {
+        return std::make_unique<Bitmap>(*container.bitmap);
+    }
+
+    auto bitmap = std::make_unique<Bitmap>();
+
+    for_each_value(container, [&](std::uint16_t value)
+    {
+        bitmap->set(value);
+    });
+
+    return bitmap;
+}
+
+inline void Dataplex::RoaringBitmap::to_array(Container& container)
+{
+    DynamicArray<std::uint16_t> values(container.cardinality);
+
+    for_each_value(container, [&](std::uint16_t value)
+    {
+        values.push_back(value);
+    });
+
+    container.type = Type::Array;
+    container.values = std::move(values);
+    container.bitmap.reset();
+}
+
+inline void Dataplex::RoaringBitmap::to_bitmap(Container& container)
+{
+    container.bitmap = make_bitmap(container);
+    container.type = Type::Bitmap;
+    container.values.clear();
+}
+
+inline void Dataplex::RoaringBitmap::expand(Container& container)
+{
+    if (container.type == Type::Run)
+    {
+        container.cardinality > ArrayLimit ? to_bitmap(container) : to_array(container);
+    }
+}
+
+inline void Dataplex::RoaringBitmap::normalize(Container& container)
+{
+    if (container.type == Type::Array && container.cardinality > ArrayLimit)
+    {
+        to_bitmap(container);
+    }
+    else if (container.type == Type::Bitmap && container.cardinality <= ArrayLimit)
+    {
+        to_array(container);
+    }
+}
+
+inline std::size_t Dataplex::RoaringBitmap::count_runs(const Container& container)
+{
+    std::size_t runs = 0;
+
+    if (container.type == Type::Array)
+    {
+        for (std::size_t i = 0; i < container.values.size(); ++i)
+        {
+            if (i == 0 || container.values[i] != container.values[i - 1] + 1)
+            {
+                ++runs;
+            }
+        }
+    }
+    else if (container.type == Type::Bitmap)
+    {
+        std::uint64_t carry = 0;
+
+        for (auto word : container.bitmap->words())
+        {
+            runs += static_cast<std::size_t>(detail::popcount(word & ~((word << 1) | carry)));
+            carry = word >> 63;
+        }
+    }
+    else
+    {
+        runs = container.values.size() / 2;
+    }
+
+    return runs;
+}
+
+template<Dataplex::detail::BitOperation Operation>
+Dataplex::RoaringBitmap& Dataplex::RoaringBitmap::combine(const RoaringBitmap& bitmap)
+{
+    constexpr auto keepLeft = Operation != detail::BitOperation::And;
+    constexpr auto keepRight = Operation == detail::BitOperation::Or || Operation == detail::BitOperation::Xor;
+
+    DynamicArray<std::uint16_t> keys;
+    DynamicArray<Container> containers;
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    while (i < _keys.size() || j < bitmap._keys.size())
+    {
+        if (j == bitmap._keys.size() || (i < _keys.size() && _keys[i] < bitmap._keys[j]))
+        {
+            if (keepLeft)
+            {
+                keys.push_back(_keys[i]);
+                containers.push_back(std::move(_containers[i]));
+            }
+
+            ++i;
+        }
+        else if (i == _keys.size() || bitmap._keys[j] < _keys[i])
+        {
+            if (keepRight)
+            {
+                keys.push_back(bitmap._keys[j]);
+                containers.push_back(bitmap._containers[j]);
+            }
+
+            ++j;
+        }
+        else
+        {
+            auto container = combine<Operation>(_containers[i], bitmap._containers[j]);
+
+            if (container.cardinality > 0)
+            {
+                keys.push_back(_keys[i]);
+                containers.push_back(std::move(container));
+            }
+
+            ++i;
+            ++j;
+        }
+    }
+
+    _keys = std::move(keys);
+    _containers = std::move(containers);
+
+    return *this;
+}
+
+inline Dataplex::RoaringBitmap Dataplex::operator&(RoaringBitmap left, const RoaringBitmap& right)
+{
+    return left &= right;
+}
+
+inline Dataplex::RoaringBitmap Dataplex::operator|(RoaringBitmap left, const RoaringBitmap& right)
+{
+    return left |= right;
+}
+
+inline Dataplex::RoaringBitmap Dataplex::operator^(RoaringBitmap left, const RoaringBitmap& right)
+{
+    return left ^= right;
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator::ConstIterator() :
+    _bitmap(nullptr),
+    _container(0),
+    _index(0),
+    _value(0)
+{
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator::ConstIterator(const RoaringBitmap* bitmap, std::size_t container) :
+    _bitmap(bitmap),
+    _container(container),
+    _index(0),
+    _value(0)
+{
+    load_container();
+}
+
+inline std::uint32_t Dataplex::RoaringBitmap::ConstIterator::operator*() const
+{
+    return static_cast<std::uint32_t>(_bitmap->_keys[_container]) << 16 | _value;
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator& Dataplex::RoaringBitmap::ConstIterator::operator++()
+{
+    const auto& container = _bitmap->_containers[_container];
+
+    if (container.type == Type::Array)
+    {
+        if (++_index < container.values.size())
+        {
+            _value = container.values[_index];
+
+            return *this;
+        }
+    }
+    else if (container.type == Type::Bitmap)
+    {
+        _value = static_cast<std::uint32_t>(container.bitmap->find_next(_value));
+
+        if (_value < container.bitmap->size())
+        {
+            return *this;
+        }
+    }
+    else
+    {
+        if (_value < static_cast<std::uint32_t>(container.values[_index]) + container.values[_index + 1])
+        {
+            ++_value;
+
+            return *this;
+        }
+        else if ((_index += 2) < container.values.size())
+        {
+            _value = container.values[_index];
+
+            return *this;
+        }
+    }
+
+    ++_container;
+    load_container();
+
+    return *this;
+}
+
+inline Dataplex::RoaringBitmap::ConstIterator Dataplex::RoaringBitmap::ConstIterator::operator++(int)
+{
+    auto iterator = *this;
+    ++*this;
+
+    return iterator;
+}
+
+inline bool Dataplex::RoaringBitmap::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _container == iterator._container && _index == iterator._index && _value == iterator._value;
+}
+
+inline bool Dataplex::RoaringBitmap::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+inline void Dataplex::RoaringBitmap::ConstIterator::load_container()
+{
+    _index = 0;
+    _value = 0;
+
+    if (_container == _bitmap->_containers.size())
+    {
+        return;
+    }
+
+    const auto& container = _bitmap->_containers[_container];
+
+    if (container.type == Type::Bitmap)
+    {
+        _value = static_cast<std::uint32_t>(container.bitmap->find_first());
+    }
+    else
+    {
+        _value = container.values[0];
+    }
+}
@@ -0,0 +1,82 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Search.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <cstddef>
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        void prefetch(const void* address);
+
+        template<typename T, typename Key, typename Compare>
+        std::size_t branchless_lower_bound(const T* data, std::size_t count, const Key& key, const Compare& comp);
+
+        template<typename T, typename Key, typename Compare>
+        std::size_t branchless_upper_bound(const T* data, std::size_t count, const Key& key, const Compare& comp);
+    }
+}
+
+inline void Dataplex::detail::prefetch(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+template<typename T, typename Key, typename Compare>
+std::size_t Dataplex::detail::branchless_lower_bound(const T* data, std::size_t count, const Key& key, const Compare& comp)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    auto base = data;
+
+    while (count > 1)
+    {
+        auto half = count / 2;
+
+        prefetch(base + half / 2);
+        prefetch(base + half + half / 2);
+
+        base = comp(base[half - 1], key) ? base + half : base;
+        count -= half;
+    }
+
+    return static_cast<std::size_t>(base - data) + (comp(*base, key) ? 1 : 0);
+}
+
+template<typename T, typename Key, typename Compare>
+std::size_t Dataplex::detail::branchless_upper_bound(const T* data, std::size_t count, const Key& key, const Compare& comp)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    auto base = data;
+
+    while (count > 1)
+    {
+        auto half = count / 2;
+
+        prefetch(base + half / 2);
+        prefetch(base + half + half / 2);
+
+        base = comp(key, base[half - 1]) ? base : base + half;
+        count -= half;
+    }
+
+    return static_cast<std::size_t>(base - data) + (comp(key, *base) ? 0 : 1);
+}
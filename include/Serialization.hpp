@@ -0,0 +1,836 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Serialization.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "HashMap.hpp"
+#include "HashSet.hpp"
+#include "StaticArray.hpp"
+#include "DynamicArray.hpp"
+#include "PriorityQueue.hpp"
+#include "SinglyLinkedList.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <string>
+#include <memory>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/uio.h>
+
+
+namespace Dataplex
+{
+    enum class ContainerTag : std::uint16_t
+    {
+        DynamicArray = 1,
+        StaticArray = 2,
+        SinglyLinkedList = 3,
+        DoublyLinkedList = 4,
+        Stack = 5,
+        Queue = 6,
+        PriorityQueue = 7,
+        HashMap = 8,
+        HashSet = 9
+    };
+
+    class BinaryWriter
+    {
+    public:
+        explicit BinaryWriter(int file);
+        BinaryWriter(const BinaryWriter& writer) = delete;
+        BinaryWriter& operator=(const BinaryWriter& writer) = delete;
+
+        ~BinaryWriter();
+
+        void write(const void* data, std::size_t size);
+        void pad(std::size_t alignment);
+        void flush();
+
+        std::size_t bytes_written() const;
+
+    private:
+        static constexpr std::size_t BufferSize = 64 * 1024;
+
+        int _file;
+        std::unique_ptr<unsigned char[]> _buffer;
+        std::size_t _bufferSize;
+        std::size_t _bytesWritten;
+
+        void write_vectors(iovec* vectors, int count);
+    };
+
+    class BinaryReader
+    {
+    public:
+        BinaryReader(const void* data, std::size_t size);
+
+        void read(void* data, std::size_t size);
+        const unsigned char* view(std::size_t size);
+        void skip_padding(std::size_t alignment);
+
+        std::size_t position() const;
+        std::size_t remaining() const;
+
+    private:
+        const unsigned char* _data;
+        std::size_t _size;
+        std::size_t _position;
+    };
+
+    template<typename T>
+    class ArrayView
+    {
+    public:
+        ArrayView();
+        ArrayView(const T* data, std::size_t size);
+
+        const T* begin() const;
+        const T* end() const;
+
+        std::reverse_iterator<const T*> rbegin() const;
+        std::reverse_iterator<const T*> rend() const;
+
+        const T& operator[](std::size_t pos) const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        const T* _data;
+        std::size_t _size;
+    };
+
+    template<typename T>
+    void write_value(BinaryWriter& writer, const T& value);
+    template<typename Char, typename Traits, typename Allocator>
+    void write_value(BinaryWriter& writer, const std::basic_string<Char, Traits, Allocator>& value);
+
+    template<typename T>
+    void read_value(BinaryReader& reader, T& value);
+    template<typename Char, typename Traits, typename Allocator>
+    void read_value(BinaryReader& reader, std::basic_string<Char, Traits, Allocator>& value);
+
+    template<typename T>
+    void serialize(BinaryWriter& writer, const DynamicArray<T>& array);
+    template<typename T, std::size_t N>
+    void serialize(BinaryWriter& writer, const StaticArray<T, N>& array);
+    template<typename T>
+    void serialize(BinaryWriter& writer, const SinglyLinkedList<T>& list);
+    template<typename T>
+    void serialize(BinaryWriter& writer, const DoublyLinkedList<T>& list);
+    template<typename T, typename Container>
+    void serialize(BinaryWriter& writer, const Stack<T, Container>& stack);
+    template<typename T, typename Container>
+    void serialize(BinaryWriter& writer, const Queue<T, Container>& queue);
+    template<typename T, typename Comp, typename Container>
+    void serialize(BinaryWriter& writer, const PriorityQueue<T, Comp, Container>& queue);
+    template<typename Key, typename Value, typename Hasher>
+    void serialize(BinaryWriter& writer, const HashMap<Key, Value, Hasher>& map);
+    template<typename T, typename Hasher>
+    void serialize(BinaryWriter& writer, const HashSet<T, Hasher>& set);
+
+    template<typename T>
+    void deserialize(BinaryReader& reader, DynamicArray<T>& array);
+    template<typename T, std::size_t N>
+    void deserialize(BinaryReader& reader, StaticArray<T, N>& array);
+    template<typename T>
+    void deserialize(BinaryReader& reader, SinglyLinkedList<T>& list);
+    template<typename T>
+    void deserialize(BinaryReader& reader, DoublyLinkedList<T>& list);
+    template<typename T, typename Container>
+    void deserialize(BinaryReader& reader, Stack<T, Container>& stack);
+    template<typename T, typename Container>
+    void deserialize(BinaryReader& reader, Queue<T, Container>& queue);
+    template<typename T, typename Comp, typename Container>
+    void deserialize(BinaryReader& reader, PriorityQueue<T, Comp, Container>& queue);
+    template<typename Key, typename Value, typename Hasher>
+    void deserialize(BinaryReader& reader, HashMap<Key, Value, Hasher>& map);
+    template<typename T, typename Hasher>
+    void deserialize(BinaryReader& reader, HashSet<T, Hasher>& set);
+
+    template<typename T>
+    ArrayView<T> deserialize_view(BinaryReader& reader);
+
+    namespace detail
+    {
+        struct SerializationHeader
+        {
+            std::uint32_t magic;
+            std::uint16_t version;
+            std::uint16_t tag;
+            std::uint32_t elementSize;
+            std::uint32_t elementAlignment;
+            std::uint64_t size;
+            std::uint64_t reserved;
+        };
+
+        constexpr std::uint32_t SerializationMagic = 0x58504C44;
+        constexpr std::uint16_t SerializationVersion = 1;
+        constexpr std::size_t SerializationAlignment = 32;
+
+        template<typename T>
+        constexpr std::uint32_t serialized_element_size();
+
+        template<typename T>
+        void write_header(BinaryWriter& writer, ContainerTag tag, std::size_t size);
+        template<typename T>
+        std::size_t read_header(BinaryReader& reader, ContainerTag tag);
+
+        template<typename T>
+        void write_elements(BinaryWriter& writer, const T* data, std::size_t size);
+        template<typename Range>
+        void write_range(BinaryWriter& writer, const Range& range);
+        template<typename T, typename Container>
+        void write_container(BinaryWriter& writer, const Container& container, std::size_t size);
+        template<typename T>
+        void read_elements(BinaryReader& reader, T* data, std::size_t size);
+
+        template<typename T, typename Range>
+        void serialize_sequence(BinaryWriter& writer, ContainerTag tag, const Range& range, std::size_t size);
+        template<typename T, typename Function>
+        void deserialize_sequence(BinaryReader& reader, ContainerTag tag, Function push);
+    }
+}
+
+inline Dataplex::BinaryWriter::BinaryWriter(int file) :
+    _file(file),
+    _buffer(new unsigned char[BufferSize]),
+    _bufferSize(0),
+    _bytesWritten(0)
+{
+}
+
+inline Dataplex::BinaryWriter::~BinaryWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+inline void Dataplex::BinaryWriter::write(const void* data, std::size_t size)
+{
+    if (_bufferSize + size <= BufferSize)
+    {
+        std::memcpy(_buffer.get() + _bufferSize, data, size);
+        _bufferSize += size;
+    }
+    else
+    {
+        iovec vectors[2];
+        vectors[0].iov_base = _buffer.get();
+        vectors[0].iov_len = _bufferSize;
+        vectors[1].iov_base = const_cast<void*>(data);
+        vectors[1].iov_len = size;
+
+        write_vectors(vectors, 2);
+
+        _bufferSize = 0;
+    }
+
+    _bytesWritten += size;
+}
+
+inline void Dataplex::BinaryWriter::pad(std::size_t alignment)
+{
+    static const unsigned char zeros[detail::SerializationAlignment] = {};
+
+    auto padding = (alignment - _bytesWritten % alignment) % alignment;
+
+    while (padding > 0)
+    {
+        auto count = std::min(padding, sizeof(zeros));
+        write(zeros, count);
+        padding -= count;
+    }
+}
+
+inline void Dataplex::BinaryWriter::flush()
+{
+    if (_bufferSize > 0)
+    {
+        iovec vector;
+        vector.iov_base = _buffer.get();
+        vector.iov_len = _bufferSize;
+
+        write_vectors(&vector, 1);
+
+        _bufferSize = 0;
+    }
+}
+
+inline std::size_t Dataplex::BinaryWriter::bytes_written() const
+{
+    return _bytesWritten;
+}
+
+inline void Dataplex::BinaryWriter::write_vectors(iovec* vectors, int count)
+{
+    while (count > 0)
+    {
+        auto written = ::writev(_file, vectors, count);
+
+        if (written == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw std::system_error(errno, std::generic_category(), "Can't write serialized data!");
+        }
+
+        auto remaining = static_cast<std::size_t>(written);
+
+        while (count > 0 && remaining >= vectors->iov_len)
+        {
+            remaining -= vectors->iov_len;
+            ++vectors;
+            --count;
+        }
+
+        if (count > 0)
+        {
+            vectors->iov_base = static_cast<unsigned char*>(vectors->iov_base) + remaining;
+            vectors->iov_len -= remaining;
+        }
+    }
+}
+
+inline Dataplex::BinaryReader::BinaryReader(const void* data, std::size_t size) :
+    _data(static_cast<const unsigned char*>(data)),
+    _size(size),
+    _position(0)
+{
+}
+
+inline void Dataplex::BinaryReader::read(void* data, std::size_t size)
+{
+    std::memcpy(data, view(size), size);
+}
+
+inline const unsigned char* Dataplex::BinaryReader::view(std::size_t size)
+{
+    if (size > remaining())
+    {
+        throw std::out_of_range("Not enough serialized data to read!");
+    }
+
+    auto data = _data + _position;
+    _position += size;
+
+    return data;
+}
+
+inline void Dataplex::BinaryReader::skip_padding(std::size_t alignment)
+{
+    view((alignment - _position % alignment) % alignment);
+}
+
+inline std::size_t Dataplex::BinaryReader::position() const
+{
+    return _position;
+}
+
+inline std::size_t Dataplex::BinaryReader::remaining() const
+{
+    return _size - _position;
+}
+
+template<typename T>
+Dataplex::ArrayView<T>::ArrayView() :
+    _data(nullptr),
+    _size(0)
+{
+}
+
+template<typename T>
+Dataplex::ArrayView<T>::ArrayView(const T* data, std::size_t size) :
+    _data(data),
+    _size(size)
+{
+}
+
+template<typename T>
+const T* Dataplex::ArrayView<T>::begin() const
+{
+    return _data;
+}
+
+template<typename T>
+const T* Dataplex::ArrayView<T>::end() const
+{
+    return _data + _size;
+}
+
+template<typename T>
+std::reverse_iterator<const T*> Dataplex::ArrayView<T>::rbegin() const
+{
+    return std::make_reverse_iterator<const T*>(end());
+}
+
+template<typename T>
+std::reverse_iterator<const T*> Dataplex::ArrayView<T>::rend() const
+{
+    return std::make_reverse_iterator<const T*>(begin());
+}
+
+template<typename T>
+const T& Dataplex::ArrayView<T>::operator[](std::size_t pos) const
+{
+    return _data[pos];
+}
+
+template<typename T>
+std::size_t Dataplex::ArrayView<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+bool Dataplex::ArrayView<T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T>
+void Dataplex::write_value(BinaryWriter& writer, const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "Provide a write_value overload for non-trivially-copyable element types!");
+
+    writer.write(&value, sizeof(T));
+}
+
+template<typename Char, typename Traits, typename Allocator>
+void Dataplex::write_value(BinaryWriter& writer, const std::basic_string<Char, Traits, Allocator>& value)
+{
+    std::uint64_t size = value.size();
+
+    writer.write(&size, sizeof(size));
+    writer.write(value.data(), value.size() * sizeof(Char));
+}
+
+template<typename T>
+void Dataplex::read_value(BinaryReader& reader, T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "Provide a read_value overload for non-trivially-copyable element types!");
+
+    reader.read(&value, sizeof(T));
+}
+
+template<typename Char, typename Traits, typename Allocator>
+void Dataplex::read_value(BinaryReader& reader, std::basic_string<Char, Traits, Allocator>& value)
+{
+    std::uint64_t size = 0;
+    reader.read(&size, sizeof(size));
+
+    if (size > reader.remaining() / sizeof(Char))
+    {
+        throw std::out_of_range("Not enough serialized data to read!");
+    }
+
+    value.resize(static_cast<std::size_t>(size));
+    reader.read(&value[0], value.size() * sizeof(Char));
+}
+
+template<typename T>
+void Dataplex::serialize(BinaryWriter& writer, const DynamicArray<T>& array)
+{
+    detail::write_header<T>(writer, ContainerTag::DynamicArray, array.size());
+    detail::write_elements(writer, array.begin(), array.size());
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename T, std::size_t N>
+void Dataplex::serialize(BinaryWriter& writer, const StaticArray<T, N>& array)
+{
+    detail::write_header<T>(writer, ContainerTag::StaticArray, N);
+    detail::write_elements(writer, array.begin(), N);
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename T>
+void Dataplex::serialize(BinaryWriter& writer, const SinglyLinkedList<T>& list)
+{
+    detail::serialize_sequence<T>(writer, ContainerTag::SinglyLinkedList, list, list.size());
+}
+
+template<typename T>
+void Dataplex::serialize(BinaryWriter& writer, const DoublyLinkedList<T>& list)
+{
+    detail::serialize_sequence<T>(writer, ContainerTag::DoublyLinkedList, list, list.size());
+}
+
+template<typename T, typename Container>
+void Dataplex::serialize(BinaryWriter& writer, const Stack<T, Container>& stack)
+{
+    detail::write_header<T>(writer, ContainerTag::Stack, stack.size());
+    detail::write_container<T>(writer, stack.container(), stack.size());
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename T, typename Container>
+void Dataplex::serialize(BinaryWriter& writer, const Queue<T, Container>& queue)
+{
+    detail::write_header<T>(writer, ContainerTag::Queue, queue.size());
+    detail::write_container<T>(writer, queue.container(), queue.size());
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename T, typename Comp, typename Container>
+void Dataplex::serialize(BinaryWriter& writer, const PriorityQueue<T, Comp, Container>& queue)
+{
+    detail::write_header<T>(writer, ContainerTag::PriorityQueue, queue.size());
+    detail::write_container<T>(writer, queue.container(), queue.size());
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::serialize(BinaryWriter& writer, const HashMap<Key, Value, Hasher>& map)
+{
+    detail::write_header<std::pair<Key, Value>>(writer, ContainerTag::HashMap, map.size());
+
+    for (const auto& entry : map)
+    {
+        write_value(writer, entry.first);
+        write_value(writer, entry.second);
+    }
+
+    writer.pad(detail::SerializationAlignment);
+}
+
+template<typename T, typename Hasher>
+void Dataplex::serialize(BinaryWriter& writer, const HashSet<T, Hasher>& set)
+{
+    detail::serialize_sequence<T>(writer, ContainerTag::HashSet, set, set.size());
+}
+
+template<typename T>
+void Dataplex::deserialize(BinaryReader& reader, DynamicArray<T>& array)
+{
+    auto size = detail::read_header<T>(reader, ContainerTag::DynamicArray);
+
+    DynamicArray<T> result;
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (size > reader.remaining() / sizeof(T))
+        {
+            throw std::out_of_range("Not enough serialized data to read!");
+        }
+
+        result.resize(size);
+
+        detail::read_elements(reader, result.begin(), size);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            T data;
+            read_value(reader, data);
+
+            result.push_back(std::move(data));
+        }
+    }
+
+    reader.skip_padding(detail::SerializationAlignment);
+
+    array = std::move(result);
+}
+
+template<typename T, std::size_t N>
+void Dataplex::deserialize(BinaryReader& reader, StaticArray<T, N>& array)
+{
+    if (detail::read_header<T>(reader, ContainerTag::StaticArray) != N)
+    {
+        throw std::runtime_error("Serialized size doesn't match static array size!");
+    }
+
+    detail::read_elements(reader, array.begin(), N);
+    reader.skip_padding(detail::SerializationAlignment);
+}
+
+template<typename T>
+void Dataplex::deserialize(BinaryReader& reader, SinglyLinkedList<T>& list)
+{
+    SinglyLinkedList<T> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::SinglyLinkedList,
+        [&result](const T& data) { result.push_back(data); });
+
+    list = std::move(result);
+}
+
+template<typename T>
+void Dataplex::deserialize(BinaryReader& reader, DoublyLinkedList<T>& list)
+{
+    DoublyLinkedList<T> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::DoublyLinkedList,
+        [&result](const T& data) { result.push_back(data); });
+
+    list = std::move(result);
+}
+
+template<typename T, typename Container>
+void Dataplex::deserialize(BinaryReader& reader, Stack<T, Container>& stack)
+{
+    Stack<T, Container> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::Stack,
+        [&result](const T& data) { result.push(data); });
+
+    stack = std::move(result);
+}
+
+template<typename T, typename Container>
+void Dataplex::deserialize(BinaryReader& reader, Queue<T, Container>& queue)
+{
+    Queue<T, Container> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::Queue,
+        [&result](const T& data) { result.push(data); });
+
+    queue = std::move(result);
+}
+
+template<typename T, typename Comp, typename Container>
+void Dataplex::deserialize(BinaryReader& reader, PriorityQueue<T, Comp, Container>& queue)
+{
+    PriorityQueue<T, Comp, Container> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::PriorityQueue,
+        [&result](const T& data) { result.push(data); });
+
+    queue = std::move(result);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::deserialize(BinaryReader& reader, HashMap<Key, Value, Hasher>& map)
+{
+    auto size = detail::read_header<std::pair<Key, Value>>(reader, ContainerTag::HashMap);
+
+    HashMap<Key, Value, Hasher> result;
+
+    if constexpr (std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value)
+    {
+        if (size > reader.remaining() / (sizeof(Key) + sizeof(Value)))
+        {
+            throw std::out_of_range("Not enough serialized data to read!");
+        }
+
+        result.reserve(size);
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        Key key;
+        Value value;
+
+        read_value(reader, key);
+        read_value(reader, value);
+
+        result.insert(std::move(key), std::move(value));
+    }
+
+    reader.skip_padding(detail::SerializationAlignment);
+
+    map = std::move(result);
+}
+
+template<typename T, typename Hasher>
+void Dataplex::deserialize(BinaryReader& reader, HashSet<T, Hasher>& set)
+{
+    HashSet<T, Hasher> result;
+
+    detail::deserialize_sequence<T>(reader, ContainerTag::HashSet,
+        [&result](const T& data) { result.insert(data); });
+
+    set = std::move(result);
+}
+
+template<typename T>
+Dataplex::ArrayView<T> Dataplex::deserialize_view(BinaryReader& reader)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Array views require trivially copyable elements!");
+    static_assert(alignof(T) <= detail::SerializationAlignment, "Array view elements are over-aligned!");
+
+    detail::SerializationHeader header;
+
+    auto peek = reader;
+    peek.skip_padding(detail::SerializationAlignment);
+    peek.read(&header, sizeof(header));
+
+    if (header.tag != static_cast<std::uint16_t>(ContainerTag::DynamicArray) &&
+        header.tag != static_cast<std::uint16_t>(ContainerTag::StaticArray))
+    {
+        throw std::runtime_error("Serialized data doesn't hold an array!");
+    }
+
+    auto size = detail::read_header<T>(reader, static_cast<ContainerTag>(header.tag));
+
+    if (size > reader.remaining() / sizeof(T))
+    {
+        throw std::out_of_range("Not enough serialized data to read!");
+    }
+
+    auto data = reader.view(size * sizeof(T));
+
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0)
+    {
+        throw std::runtime_error("Serialized array isn't aligned for a view!");
+    }
+
+    reader.skip_padding(detail::SerializationAlignment);
+
+    return ArrayView<T>(reinterpret_cast<const T*>(data), size);
+}
+
+template<typename T>
+constexpr std::uint32_t Dataplex::detail::serialized_element_size()
+{
+    return std::is_trivially_copyable<T>::value ? sizeof(T) : 0;
+}
+
+template<typename T>
+void Dataplex::detail::write_header(BinaryWriter& writer, ContainerTag tag, std::size_t size)
+{
+    SerializationHeader header = {};
+    header.magic = SerializationMagic;
+    header.version = SerializationVersion;
+    header.tag = static_cast<std::uint16_t>(tag);
+    header.elementSize = serialized_element_size<T>();
+    header.elementAlignment = alignof(T);
+    header.size = size;
+
+    writer.pad(SerializationAlignment);
+    writer.write(&header, sizeof(header));
+}
+
+template<typename T>
+std::size_t Dataplex::detail::read_header(BinaryReader& reader, ContainerTag tag)
+{
+    reader.skip_padding(SerializationAlignment);
+
+    SerializationHeader header;
+    reader.read(&header, sizeof(header));
+
+    if (header.magic != SerializationMagic || header.version != SerializationVersion)
+    {
+        throw std::runtime_error("Serialized data has an incompatible header!");
+    }
+    else if (header.tag != static_cast<std::uint16_t>(tag))
+    {
+        throw std::runtime_error("Serialized data holds a different container!");
+    }
+    else if (header.elementSize != serialized_element_size<T>() || header.elementAlignment != alignof(T))
+    {
+        throw std::runtime_error("Serialized data holds a different element type!");
+    }
+
+    return static_cast<std::size_t>(header.size);
+}
+
+template<typename T>
+void Dataplex::detail::write_elements(BinaryWriter& writer, const T* data, std::size_t size)
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        writer.write(data, size * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            write_value(writer, data[i]);
+        }
+    }
+}
+
+template<typename Range>
+void Dataplex::detail::write_range(BinaryWriter& writer, const Range& range)
+{
+    for (const auto& data : range)
+    {
+        write_value(writer, data);
+    }
+}
+
+template<typename T, typename Container>
+void Dataplex::detail::write_container(BinaryWriter& writer, const Container& container, std::size_t size)
+{
+    if constexpr (std::is_pointer<decltype(container.begin())>::value)
+    {
+        write_elements(writer, container.begin(), size);
+    }
+    else
+    {
+        write_range(writer, container);
+    }
+}
+
+template<typename T>
+void Dataplex::detail::read_elements(BinaryReader& reader, T* data, std::size_t size)
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (size > reader.remaining() / sizeof(T))
+        {
+            throw std::out_of_range("Not enough serialized data to read!");
+        }
+
+        reader.read(data, size * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            read_value(reader, data[i]);
+        }
+    }
+}
+
+template<typename T, typename Range>
+void Dataplex::detail::serialize_sequence(BinaryWriter& writer, ContainerTag tag, const Range& range, std::size_t size)
+{
+    write_header<T>(writer, tag, size);
+    write_range(writer, range);
+    writer.pad(SerializationAlignment);
+}
+
+template<typename T, typename Function>
+void Dataplex::detail::deserialize_sequence(BinaryReader& reader, ContainerTag tag, Function push)
+{
+    auto size = read_header<T>(reader, tag);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        T data;
+        read_value(reader, data);
+
+        push(data);
+    }
+
+    reader.skip_padding(SerializationAlignment);
+}
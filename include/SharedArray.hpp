@@ -0,0 +1,566 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - SharedArray.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <initializer_list>
+
+
+namespace Dataplex
+{
+    // Non-const element access or iteration marks the buffer unsharable, because the returned
+    // references may still be written through. Copies and snapshots of an unsharable array are
+    // deep copies. The mark stays until the array reallocates or is cleared.
+    template<typename T>
+    class SharedArray
+    {
+    public:
+        SharedArray();
+        SharedArray(const SharedArray<T>& array);
+        SharedArray<T>& operator=(const SharedArray<T>& array);
+        SharedArray(SharedArray<T>&& array);
+        SharedArray<T>& operator=(SharedArray<T>&& array);
+        explicit SharedArray(std::size_t capacity);
+        explicit SharedArray(const DynamicArray<T>& array);
+        SharedArray(std::initializer_list<T> list);
+
+        ~SharedArray();
+
+        T* begin();
+        const T* begin() const;
+
+        T* end();
+        const T* end() const;
+
+        T& operator[](std::size_t pos);
+        const T& operator[](std::size_t pos) const;
+
+        T& head();
+        const T& head() const;
+
+        T& tail();
+        const T& tail() const;
+
+        void push_back(const T& data);
+        void push_back(T&& data);
+
+        template<typename... Args>
+        void emplace_back(Args&&... args);
+
+        void pop_back();
+
+        void insert(const T& data, std::size_t pos);
+        void insert(T&& data, std::size_t pos);
+        void erase(std::size_t pos);
+
+        void resize(std::size_t size);
+        void reserve(std::size_t capacity);
+        void shrink_to_fit();
+        void clear();
+
+        SharedArray<T> snapshot() const;
+        void detach();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+        bool is_shared() const;
+
+    private:
+        struct Buffer
+        {
+            explicit Buffer(std::size_t capacity);
+            ~Buffer();
+
+            std::atomic<std::size_t> references;
+            bool sharable;
+            std::size_t size;
+            std::size_t capacity;
+            T* array;
+        };
+
+        Buffer* _buffer;
+
+        T* mutable_data();
+
+        void grow();
+        void reallocate(std::size_t capacity);
+        void release();
+
+        static Buffer* copy(const Buffer& buffer);
+
+        void swap(SharedArray<T>& array);
+    };
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray() :
+    _buffer(nullptr)
+{
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray(const SharedArray<T>& array) :
+    _buffer(array._buffer)
+{
+    if (_buffer && !_buffer->sharable)
+    {
+        _buffer = copy(*_buffer);
+    }
+    else if (_buffer)
+    {
+        _buffer->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+Dataplex::SharedArray<T>& Dataplex::SharedArray<T>::operator=(const SharedArray<T>& array)
+{
+    SharedArray<T> temp(array);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray(SharedArray<T>&& array) :
+    SharedArray()
+{
+    swap(array);
+}
+
+template<typename T>
+Dataplex::SharedArray<T>& Dataplex::SharedArray<T>::operator=(SharedArray<T>&& array)
+{
+    swap(array);
+
+    return *this;
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray(std::size_t capacity) :
+    SharedArray()
+{
+    reserve(capacity);
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray(const DynamicArray<T>& array) :
+    SharedArray(array.size())
+{
+    for (const auto& data : array)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::SharedArray(std::initializer_list<T> list) :
+    SharedArray(list.size())
+{
+    for (const auto& data : list)
+    {
+        push_back(data);
+    }
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::~SharedArray()
+{
+    release();
+}
+
+template<typename T>
+T* Dataplex::SharedArray<T>::begin()
+{
+    return mutable_data();
+}
+
+template<typename T>
+const T* Dataplex::SharedArray<T>::begin() const
+{
+    return _buffer ? _buffer->array : nullptr;
+}
+
+template<typename T>
+T* Dataplex::SharedArray<T>::end()
+{
+    auto array = mutable_data();
+
+    return array ? array + _buffer->size : nullptr;
+}
+
+template<typename T>
+const T* Dataplex::SharedArray<T>::end() const
+{
+    return _buffer ? _buffer->array + _buffer->size : nullptr;
+}
+
+template<typename T>
+T& Dataplex::SharedArray<T>::operator[](std::size_t pos)
+{
+    return mutable_data()[pos];
+}
+
+template<typename T>
+const T& Dataplex::SharedArray<T>::operator[](std::size_t pos) const
+{
+    return _buffer->array[pos];
+}
+
+template<typename T>
+T& Dataplex::SharedArray<T>::head()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return mutable_data()[0];
+}
+
+template<typename T>
+const T& Dataplex::SharedArray<T>::head() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Head not initialized!");
+    }
+
+    return _buffer->array[0];
+}
+
+template<typename T>
+T& Dataplex::SharedArray<T>::tail()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return mutable_data()[_buffer->size - 1];
+}
+
+template<typename T>
+const T& Dataplex::SharedArray<T>::tail() const
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Tail not initialized!");
+    }
+
+    return _buffer->array[_buffer->size - 1];
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::push_back(const T& data)
+{
+    emplace_back(data);
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::push_back(T&& data)
+{
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::SharedArray<T>::emplace_back(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);
+
+    if (size() == capacity())
+    {
+        grow();
+    }
+    else
+    {
+        detach();
+    }
+
+    _buffer->array[_buffer->size++] = std::move(data);
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::pop_back()
+{
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop back empty shared array!");
+    }
+
+    detach();
+
+    _buffer->array[--_buffer->size] = T();
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::insert(const T& data, std::size_t pos)
+{
+    insert(T(data), pos);
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::insert(T&& data, std::size_t pos)
+{
+    if (pos > size())
+    {
+        throw std::out_of_range("Insert position outside of existing range!");
+    }
+
+    if (size() == capacity())
+    {
+        grow();
+    }
+    else
+    {
+        detach();
+    }
+
+    auto array = _buffer->array;
+
+    for (std::size_t i = _buffer->size; i > pos; --i)
+    {
+        array[i] = std::move(array[i - 1]);
+    }
+
+    array[pos] = std::move(data);
+
+    ++_buffer->size;
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::erase(std::size_t pos)
+{
+    if (pos >= size())
+    {
+        throw std::out_of_range("Erase position outside of existing range!");
+    }
+
+    detach();
+
+    auto array = _buffer->array;
+
+    for (std::size_t i = pos + 1; i < _buffer->size; ++i)
+    {
+        array[i - 1] = std::move(array[i]);
+    }
+
+    array[--_buffer->size] = T();
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::resize(std::size_t size)
+{
+    if (size > capacity())
+    {
+        reallocate(size);
+    }
+    else if (size != this->size())
+    {
+        detach();
+    }
+
+    if (!_buffer)
+    {
+        return;
+    }
+
+    for (std::size_t i = _buffer->size; i < size; ++i)
+    {
+        _buffer->array[i] = T();
+    }
+
+    for (std::size_t i = size; i < _buffer->size; ++i)
+    {
+        _buffer->array[i] = T();
+    }
+
+    _buffer->size = size;
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::reserve(std::size_t capacity)
+{
+    if (capacity > this->capacity())
+    {
+        reallocate(capacity);
+    }
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::shrink_to_fit()
+{
+    if (size() < capacity())
+    {
+        reallocate(size());
+    }
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::clear()
+{
+    release();
+
+    _buffer = nullptr;
+}
+
+template<typename T>
+Dataplex::SharedArray<T> Dataplex::SharedArray<T>::snapshot() const
+{
+    return *this;
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::detach()
+{
+    if (is_shared())
+    {
+        reallocate(_buffer->capacity);
+    }
+}
+
+template<typename T>
+std::size_t Dataplex::SharedArray<T>::size() const
+{
+    return _buffer ? _buffer->size : 0;
+}
+
+template<typename T>
+std::size_t Dataplex::SharedArray<T>::capacity() const
+{
+    return _buffer ? _buffer->capacity : 0;
+}
+
+template<typename T>
+bool Dataplex::SharedArray<T>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename T>
+bool Dataplex::SharedArray<T>::is_shared() const
+{
+    return _buffer && _buffer->references.load(std::memory_order_acquire) > 1;
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::Buffer::Buffer(std::size_t capacity) :
+    references(1),
+    sharable(true),
+    size(0),
+    capacity(capacity),
+    array(new T[capacity])
+{
+}
+
+template<typename T>
+Dataplex::SharedArray<T>::Buffer::~Buffer()
+{
+    delete[] array;
+}
+
+template<typename T>
+T* Dataplex::SharedArray<T>::mutable_data()
+{
+    detach();
+
+    if (!_buffer)
+    {
+        return nullptr;
+    }
+
+    _buffer->sharable = false;
+
+    return _buffer->array;
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::grow()
+{
+    reallocate(capacity() > 0 ? capacity() * 2 : 1);
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::reallocate(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        clear();
+
+        return;
+    }
+
+    auto buffer = new Buffer(capacity);
+
+    if (_buffer)
+    {
+        auto size = _buffer->size < capacity ? _buffer->size : capacity;
+
+        if (is_shared())
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                buffer->array[i] = _buffer->array[i];
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                buffer->array[i] = std::move(_buffer->array[i]);
+            }
+        }
+
+        buffer->size = size;
+    }
+
+    release();
+
+    _buffer = buffer;
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::release()
+{
+    if (_buffer && _buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete _buffer;
+    }
+}
+
+template<typename T>
+typename Dataplex::SharedArray<T>::Buffer* Dataplex::SharedArray<T>::copy(const Buffer& buffer)
+{
+    auto copied = std::make_unique<Buffer>(buffer.capacity);
+
+    for (std::size_t i = 0; i < buffer.size; ++i)
+    {
+        copied->array[i] = buffer.array[i];
+    }
+
+    copied->size = buffer.size;
+
+    return copied.release();
+}
+
+template<typename T>
+void Dataplex::SharedArray<T>::swap(SharedArray<T>& array)
+{
+    using std::swap;
+
+    swap(_buffer, array._buffer);
+}
@@ -8,8 +8,11 @@ http://inversepalindrome.com
 #pragma once
 
 #include <cstddef>
+#include <utility>
 #include <iterator>
 #include <exception>
+#include <stdexcept>
+#include <initializer_list>
 
 
 namespace Dataplex
@@ -43,7 +46,14 @@ namespace Dataplex
         const T& tail() const;
 
         void push_front(const T& data);
+        void push_front(T&& data);
         void push_back(const T& data);
+        void push_back(T&& data);
+
+        template<typename... Args>
+        void emplace_front(Args&&... args);
+        template<typename... Args>
+        void emplace_back(Args&&... args);
 
         void pop_front();
         void pop_back();
@@ -59,21 +69,23 @@ namespace Dataplex
     private:
         struct Node
         {
-            explicit Node(const T& data);
+            template<typename... Args>
+            explicit Node(Args&&... args);
 
             Node* next;
             T data;
         };
 
+    public:
         class Iterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::forward_iterator_tag;
 
-        public:
             explicit Iterator(Node* node);
 
             Iterator& operator=(Node* node);
@@ -93,13 +105,13 @@ namespace Dataplex
 
         class ConstIterator
         {
+        public:
             using value_type = T;
             using difference_type = std::ptrdiff_t;
             using pointer = T*;
             using reference = T&;
             using iterator_category = std::forward_iterator_tag;
 
-        public:
             explicit ConstIterator(Node* node);
 
             ConstIterator& operator=(Node* node);
@@ -117,6 +129,7 @@ namespace Dataplex
             Node* _node;
         };
 
+    private:
         Node* _head;
         Node* _tail;
 
@@ -258,7 +271,20 @@ const T& Dataplex::SinglyLinkedList<T>::tail() const
 template<typename T>
 void Dataplex::SinglyLinkedList<T>::push_front(const T& data)
 {
-    Node* node = new Node(data);
+    emplace_front(data);
+}
+
+template<typename T>
+void Dataplex::SinglyLinkedList<T>::push_front(T&& data)
+{
+    emplace_front(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::SinglyLinkedList<T>::emplace_front(Args&&... args)
+{
+    Node* node = new Node(std::forward<Args>(args)...);
 
     if (!_head)
     {
@@ -277,7 +303,20 @@ void Dataplex::SinglyLinkedList<T>::push_front(const T& data)
 template<typename T>
 void Dataplex::SinglyLinkedList<T>::push_back(const T& data)
 {
-    Node* node = new Node(data);
+    emplace_back(data);
+}
+
+template<typename T>
+void Dataplex::SinglyLinkedList<T>::push_back(T&& data)
+{
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::SinglyLinkedList<T>::emplace_back(Args&&... args)
+{
+    Node* node = new Node(std::forward<Args>(args)...);
 
     if (!_head)
     {
@@ -461,9 +500,10 @@ bool Dataplex::SinglyLinkedList<T>::is_empty() const
 }
 
 template<typename T>
-Dataplex::SinglyLinkedList<T>::Node::Node(const T& data) :
+template<typename... Args>
+Dataplex::SinglyLinkedList<T>::Node::Node(Args&&... args) :
     next(nullptr),
-    data(data)
+    data(std::forward<Args>(args)...)
 {
 }
 
@@ -0,0 +1,669 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Sort.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Utility.hpp"
+#include "ThreadPool.hpp"
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+
+namespace Dataplex
+{
+    template<typename Range>
+    void sort(Range& range);
+    template<typename Range, typename Compare>
+    void sort(Range& range, Compare comp);
+
+    template<typename Range, typename Compare = std::less<>>
+    void pdq_sort(Range& range, Compare comp = Compare());
+
+    template<typename Range>
+    void radix_sort(Range& range);
+    template<typename Range, typename KeyExtractor>
+    void radix_sort(Range& range, KeyExtractor key);
+
+    namespace parallel
+    {
+        template<typename Range>
+        void radix_sort(Range& range, ThreadPool& pool = ThreadPool::global());
+        template<typename Range, typename KeyExtractor>
+        void radix_sort(Range& range, KeyExtractor key, ThreadPool& pool = ThreadPool::global());
+    }
+
+    namespace detail
+    {
+        constexpr std::size_t RadixSortThreshold = 256;
+        constexpr std::size_t ParallelRadixSortThreshold = std::size_t(1) << 22;
+
+        constexpr std::ptrdiff_t InsertionSortThreshold = 24;
+        constexpr std::ptrdiff_t NintherThreshold = 128;
+        constexpr std::ptrdiff_t PartialInsertionSortLimit = 8;
+
+        template<typename T>
+        auto radix_key(T value);
+
+        template<typename T>
+        struct IdentityKey
+        {
+            const T& operator()(const T& value) const;
+        };
+
+        template<typename Range>
+        constexpr bool is_contiguous_range = std::is_pointer<decltype(std::declval<Range&>().begin())>::value;
+
+        template<typename T, typename KeyExtractor>
+        void lsd_radix_sort(T* first, std::size_t size, KeyExtractor key);
+
+        template<typename T, typename KeyExtractor>
+        void parallel_lsd_radix_sort(T* first, std::size_t size, KeyExtractor key, ThreadPool& pool);
+
+        template<typename RandomIt, typename Compare>
+        void pdq_sort(RandomIt first, RandomIt last, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        void pdq_sort_loop(RandomIt first, RandomIt last, Compare comp, int badAllowed, bool leftmost);
+
+        template<typename RandomIt, typename Compare>
+        void insertion_sort(RandomIt first, RandomIt last, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        bool partial_insertion_sort(RandomIt first, RandomIt last, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        void sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        std::pair<RandomIt, bool> partition_right(RandomIt first, RandomIt last, Compare comp);
+
+        template<typename RandomIt, typename Compare>
+        RandomIt partition_left(RandomIt first, RandomIt last, Compare comp);
+    }
+}
+
+template<typename Range>
+void Dataplex::sort(Range& range)
+{
+    using T = std::decay_t<decltype(*range.begin())>;
+
+    auto first = range.begin();
+    auto size = static_cast<std::size_t>(std::distance(first, range.end()));
+
+    if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, long double>::value &&
+        detail::is_contiguous_range<Range>)
+    {
+        if (size >= detail::ParallelRadixSortThreshold)
+        {
+            parallel::radix_sort(range);
+        }
+        else if (size >= detail::RadixSortThreshold)
+        {
+            radix_sort(range);
+        }
+        else
+        {
+            detail::pdq_sort(first, first + size, std::less<>());
+        }
+    }
+    else
+    {
+        detail::pdq_sort(first, first + size, std::less<>());
+    }
+}
+
+template<typename Range, typename Compare>
+void Dataplex::sort(Range& range, Compare comp)
+{
+    pdq_sort(range, comp);
+}
+
+template<typename Range, typename Compare>
+void Dataplex::pdq_sort(Range& range, Compare comp)
+{
+    auto first = range.begin();
+
+    detail::pdq_sort(first, first + std::distance(first, range.end()), comp);
+}
+
+template<typename Range>
+void Dataplex::radix_sort(Range& range)
+{
+    using T = std::decay_t<decltype(*range.begin())>;
+
+    radix_sort(range, detail::IdentityKey<T>());
+}
+
+template<typename Range, typename KeyExtractor>
+void Dataplex::radix_sort(Range& range, KeyExtractor key)
+{
+    static_assert(detail::is_contiguous_range<Range>, "Radix sort requires contiguous storage!");
+
+    auto first = range.begin();
+
+    detail::lsd_radix_sort(first, static_cast<std::size_t>(std::distance(first, range.end())),
+        [&key](const auto& value) { return detail::radix_key(key(value)); });
+}
+
+template<typename Range>
+void Dataplex::parallel::radix_sort(Range& range, ThreadPool& pool)
+{
+    using T = std::decay_t<decltype(*range.begin())>;
+
+    radix_sort(range, Dataplex::detail::IdentityKey<T>(), pool);
+}
+
+template<typename Range, typename KeyExtractor>
+void Dataplex::parallel::radix_sort(Range& range, KeyExtractor key, ThreadPool& pool)
+{
+    static_assert(Dataplex::detail::is_contiguous_range<Range>, "Radix sort requires contiguous storage!");
+
+    auto first = range.begin();
+
+    Dataplex::detail::parallel_lsd_radix_sort(first, static_cast<std::size_t>(std::distance(first, range.end())),
+        [&key](const auto& value) { return Dataplex::detail::radix_key(key(value)); }, pool);
+}
+
+template<typename T>
+auto Dataplex::detail::radix_key(T value)
+{
+    static_assert(std::is_arithmetic<T>::value, "Radix sort keys must be arithmetic!");
+
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        return static_cast<std::uint8_t>(value);
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported floating point radix sort key!");
+
+        using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        constexpr Bits signBit = Bits(1) << (sizeof(T) * 8 - 1);
+
+        Bits bits;
+        std::memcpy(&bits, &value, sizeof(T));
+
+        return (bits & signBit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+    }
+    else if constexpr (std::is_signed<T>::value)
+    {
+        using Bits = std::make_unsigned_t<T>;
+
+        return static_cast<Bits>(static_cast<Bits>(value) ^ (Bits(1) << (sizeof(T) * 8 - 1)));
+    }
+    else
+    {
+        return value;
+    }
+}
+
+template<typename T>
+const T& Dataplex::detail::IdentityKey<T>::operator()(const T& value) const
+{
+    return value;
+}
+
+template<typename T, typename KeyExtractor>
+void Dataplex::detail::lsd_radix_sort(T* first, std::size_t size, KeyExtractor key)
+{
+    using Key = decltype(key(*first));
+
+    constexpr std::size_t passes = sizeof(Key);
+
+    if (size < 2)
+    {
+        return;
+    }
+
+    std::size_t counts[passes][256] = {};
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        auto value = key(first[i]);
+
+        for (std::size_t pass = 0; pass < passes; ++pass)
+        {
+            ++counts[pass][(value >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    ScratchBuffer<T> buffer(first, size);
+
+    T* from = buffer.get();
+    T* to = first;
+
+    for (std::size_t pass = 0; pass < passes; ++pass)
+    {
+        if (counts[pass][(key(*from) >> (pass * 8)) & 0xFF] == size)
+        {
+            continue;
+        }
+
+        std::size_t offsets[256];
+        std::size_t offset = 0;
+
+        for (std::size_t digit = 0; digit < 256; ++digit)
+        {
+            offsets[digit] = offset;
+            offset += counts[pass][digit];
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            to[offsets[(key(from[i]) >> (pass * 8)) & 0xFF]++] = std::move(from[i]);
+        }
+
+        std::swap(from, to);
+    }
+
+    if (from != first)
+    {
+        std::move(from, from + size, first);
+    }
+}
+
+template<typename T, typename KeyExtractor>
+void Dataplex::detail::parallel_lsd_radix_sort(T* first, std::size_t size, KeyExtractor key, ThreadPool& pool)
+{
+    using Key = decltype(key(*first));
+
+    constexpr std::size_t passes = sizeof(Key);
+
+    if (size <= RadixSortThreshold || pool.thread_count() < 2)
+    {
+        lsd_radix_sort(first, size, key);
+
+        return;
+    }
+
+    auto chunkSize = std::max<std::size_t>(size / (pool.thread_count() * 4), RadixSortThreshold);
+    auto chunks = (size + chunkSize - 1) / chunkSize;
+
+    std::unique_ptr<std::size_t[]> offsets(new std::size_t[chunks * 256]);
+    ScratchBuffer<T> buffer(first, size);
+
+    T* from = buffer.get();
+    T* to = first;
+
+    for (std::size_t pass = 0; pass < passes; ++pass)
+    {
+        auto shift = pass * 8;
+
+        pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+            {
+                for (auto chunk = begin; chunk < end; ++chunk)
+                {
+                    auto counts = offsets.get() + chunk * 256;
+                    auto chunkEnd = std::min((chunk + 1) * chunkSize, size);
+
+                    std::fill(counts, counts + 256, 0);
+
+                    for (auto i = chunk * chunkSize; i < chunkEnd; ++i)
+                    {
+                        ++counts[(key(from[i]) >> shift) & 0xFF];
+                    }
+                }
+            });
+
+        std::size_t offset = 0;
+        bool uniform = false;
+
+        for (std::size_t digit = 0; digit < 256 && !uniform; ++digit)
+        {
+            auto digitStart = offset;
+
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                auto count = offsets[chunk * 256 + digit];
+
+                offsets[chunk * 256 + digit] = offset;
+                offset += count;
+            }
+
+            uniform = offset - digitStart == size;
+        }
+
+        if (uniform)
+        {
+            continue;
+        }
+
+        pool.parallel_for(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+            {
+                for (auto chunk = begin; chunk < end; ++chunk)
+                {
+                    auto chunkOffsets = offsets.get() + chunk * 256;
+                    auto chunkEnd = std::min((chunk + 1) * chunkSize, size);
+
+                    for (auto i = chunk * chunkSize; i < chunkEnd; ++i)
+                    {
+                        to[chunkOffsets[(key(from[i]) >> shift) & 0xFF]++] = std::move(from[i]);
+                    }
+                }
+            });
+
+        std::swap(from, to);
+    }
+
+    if (from != first)
+    {
+        pool.parallel_for(0, size, chunkSize, [&](std::size_t begin, std::size_t end)
+            {
+                std::move(from + begin, from + end, first + begin);
+            });
+    }
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::pdq_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    int badAllowed = 0;
+
+    for (auto size = last - first; size > 1; size >>= 1)
+    {
+        ++badAllowed;
+    }
+
+    pdq_sort_loop(first, last, comp, badAllowed, true);
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::pdq_sort_loop(RandomIt first, RandomIt last, Compare comp, int badAllowed, bool leftmost)
+{
+    while (true)
+    {
+        auto size = last - first;
+
+        if (size < InsertionSortThreshold)
+        {
+            if (leftmost)
+            {
+                insertion_sort(first, last, comp);
+            }
+            else
+            {
+                unguarded_insertion_sort(first, last, comp);
+            }
+
+            return;
+        }
+
+        auto half = size / 2;
+
+        if (size > NintherThreshold)
+        {
+            sort3(first, first + half, last - 1, comp);
+            sort3(first + 1, first + (half - 1), last - 2, comp);
+            sort3(first + 2, first + (half + 1), last - 3, comp);
+            sort3(first + (half - 1), first + half, first + (half + 1), comp);
+            std::iter_swap(first, first + half);
+        }
+        else
+        {
+            sort3(first + half, first, last - 1, comp);
+        }
+
+        if (!leftmost && !comp(*(first - 1), *first))
+        {
+            first = partition_left(first, last, comp) + 1;
+
+            continue;
+        }
+
+        auto partition = partition_right(first, last, comp);
+        auto pivot = partition.first;
+        auto alreadyPartitioned = partition.second;
+
+        auto leftSize = pivot - first;
+        auto rightSize = last - (pivot + 1);
+
+        if (leftSize < size / 8 || rightSize < size / 8)
+        {
+            if (--badAllowed == 0)
+            {
+                std::make_heap(first, last, comp);
+                std::sort_heap(first, last, comp);
+
+                return;
+            }
+
+            if (leftSize >= InsertionSortThreshold)
+            {
+                std::iter_swap(first, first + leftSize / 4);
+                std::iter_swap(pivot - 1, pivot - leftSize / 4);
+
+                if (leftSize > NintherThreshold)
+                {
+                    std::iter_swap(first + 1, first + (leftSize / 4 + 1));
+                    std::iter_swap(first + 2, first + (leftSize / 4 + 2));
+                    std::iter_swap(pivot - 2, pivot - (leftSize / 4 + 1));
+                    std::iter_swap(pivot - 3, pivot - (leftSize / 4 + 2));
+                }
+            }
+
+            if (rightSize >= InsertionSortThreshold)
+            {
+                std::iter_swap(pivot + 1, pivot + (1 + rightSize / 4));
+                std::iter_swap(last - 1, last - rightSize / 4);
+
+                if (rightSize > NintherThreshold)
+                {
+                    std::iter_swap(pivot + 2, pivot + (2 + rightSize / 4));
+                    std::iter_swap(pivot + 3, pivot + (3 + rightSize / 4));
+                    std::iter_swap(last - 2, last - (1 + rightSize / 4));
+                    std::iter_swap(last - 3, last - (2 + rightSize / 4));
+                }
+            }
+        }
+        else if (alreadyPartitioned && partial_insertion_sort(first, pivot, comp) &&
+            partial_insertion_sort(pivot + 1, last, comp))
+        {
+            return;
+        }
+
+        pdq_sort_loop(first, pivot, comp, badAllowed, leftmost);
+
+        first = pivot + 1;
+        leftmost = false;
+    }
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::insertion_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (auto current = first + 1; current != last; ++current)
+    {
+        auto sift = current;
+        auto previous = current - 1;
+
+        if (comp(*sift, *previous))
+        {
+            auto value = std::move(*sift);
+
+            do
+            {
+                *sift-- = std::move(*previous);
+            } while (sift != first && comp(value, *--previous));
+
+            *sift = std::move(value);
+        }
+    }
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::unguarded_insertion_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (auto current = first + 1; current != last; ++current)
+    {
+        auto sift = current;
+        auto previous = current - 1;
+
+        if (comp(*sift, *previous))
+        {
+            auto value = std::move(*sift);
+
+            do
+            {
+                *sift-- = std::move(*previous);
+            } while (comp(value, *--previous));
+
+            *sift = std::move(value);
+        }
+    }
+}
+
+template<typename RandomIt, typename Compare>
+bool Dataplex::detail::partial_insertion_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+    {
+        return true;
+    }
+
+    std::ptrdiff_t moves = 0;
+
+    for (auto current = first + 1; current != last; ++current)
+    {
+        auto sift = current;
+        auto previous = current - 1;
+
+        if (comp(*sift, *previous))
+        {
+            auto value = std::move(*sift);
+
+            do
+            {
+                *sift-- = std::move(*previous);
+            } while (sift != first && comp(value, *--previous));
+
+            *sift = std::move(value);
+            moves += current - sift;
+        }
+
+        if (moves > PartialInsertionSortLimit)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename RandomIt, typename Compare>
+void Dataplex::detail::sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp)
+{
+    if (comp(*b, *a))
+    {
+        std::iter_swap(a, b);
+    }
+
+    if (comp(*c, *b))
+    {
+        std::iter_swap(b, c);
+    }
+
+    if (comp(*b, *a))
+    {
+        std::iter_swap(a, b);
+    }
+}
+
+template<typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> Dataplex::detail::partition_right(RandomIt first, RandomIt last, Compare comp)
+{
+    auto pivot = std::move(*first);
+
+    auto left = first;
+    auto right = last;
+
+    while (comp(*++left, pivot));
+
+    if (left - 1 == first)
+    {
+        while (left < right && !comp(*--right, pivot));
+    }
+    else
+    {
+        while (!comp(*--right, pivot));
+    }
+
+    bool alreadyPartitioned = left >= right;
+
+    while (left < right)
+    {
+        std::iter_swap(left, right);
+
+        while (comp(*++left, pivot));
+        while (!comp(*--right, pivot));
+    }
+
+    auto pivotPos = left - 1;
+    *first = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+
+    return std::make_pair(pivotPos, alreadyPartitioned);
+}
+
+template<typename RandomIt, typename Compare>
+RandomIt Dataplex::detail::partition_left(RandomIt first, RandomIt last, Compare comp)
+{
+    auto pivot = std::move(*first);
+
+    auto left = first;
+    auto right = last;
+
+    while (comp(pivot, *--right));
+
+    if (right + 1 == last)
+    {
+        while (left < right && !comp(pivot, *++left));
+    }
+    else
+    {
+        while (!comp(pivot, *++left));
+    }
+
+    while (left < right)
+    {
+        std::iter_swap(left, right);
+
+        while (comp(pivot, *--right));
+        while (!comp(pivot, *++left));
+    }
+
+    auto pivotPos = right;
+    *first = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+
+    return pivotPos;
+}
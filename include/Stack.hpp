@@ -7,12 +7,15 @@ http://inversepalindrome.com
 
 #pragma once
 
-#include "DynamicArray.hpp"
+#include "Deque.hpp"
+
+#include <utility>
+#include <stdexcept>
 
 
 namespace Dataplex
 {
-    template<typename T>
+    template<typename T, typename Container = Deque<T>>
     class Stack
     {
     public:
@@ -20,63 +23,119 @@ namespace Dataplex
         const T& top() const;
 
         void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
         void pop();
+        T pop_value();
+        bool try_pop(T& data);
+
+        const Container& container() const;
 
         std::size_t size() const;
         bool is_empty() const;
 
     private:
-        DynamicArray<T> _array;
+        Container _container;
     };
 }
 
-template<typename T>
-T& Dataplex::Stack<T>::top()
+template<typename T, typename Container>
+T& Dataplex::Stack<T, Container>::top()
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the stack!");
     }
 
-    return _array[_array.size() - 1];
+    return _container.tail();
 }
 
-template<typename T>
-const T& Dataplex::Stack<T>::top() const
+template<typename T, typename Container>
+const T& Dataplex::Stack<T, Container>::top() const
 {
     if (is_empty())
     {
         throw std::out_of_range("No element exists in the stack!");
     }
 
-    return _array[_array.size() - 1];
+    return _container.tail();
+}
+
+template<typename T, typename Container>
+void Dataplex::Stack<T, Container>::push(const T& data)
+{
+    _container.push_back(data);
+}
+
+template<typename T, typename Container>
+void Dataplex::Stack<T, Container>::push(T&& data)
+{
+    _container.push_back(std::move(data));
 }
 
-template<typename T>
-void Dataplex::Stack<T>::push(const T& data)
+template<typename T, typename Container>
+template<typename... Args>
+void Dataplex::Stack<T, Container>::emplace(Args&&... args)
 {
-    _array.push_back(data);
+    _container.emplace_back(std::forward<Args>(args)...);
 }
 
-template<typename T>
-void Dataplex::Stack<T>::pop()
+template<typename T, typename Container>
+void Dataplex::Stack<T, Container>::pop()
 {
     if (is_empty())
     {
         throw std::out_of_range("Can't pop empty stack!");
     }
 
-    _array.pop_back();
+    _container.pop_back();
 }
 
-template<typename T>
-std::size_t Dataplex::Stack<T>::size() const
+template<typename T, typename Container>
+T Dataplex::Stack<T, Container>::pop_value()
 {
-    return _array.size();
+    if (is_empty())
+    {
+        throw std::out_of_range("Can't pop empty stack!");
+    }
+
+    T data = std::move(_container.tail());
+    _container.pop_back();
+
+    return data;
 }
 
-template<typename T>
-bool Dataplex::Stack<T>::is_empty() const
+template<typename T, typename Container>
+bool Dataplex::Stack<T, Container>::try_pop(T& data)
 {
-    return _array.is_empty();
-}
\ No newline at end of file
+    if (is_empty())
+    {
+        return false;
+    }
+
+    data = std::move(_container.tail());
+    _container.pop_back();
+
+    return true;
+}
+
+template<typename T, typename Container>
+const Container& Dataplex::Stack<T, Container>::container() const
+{
+    return _container;
+}
+
+template<typename T, typename Container>
+std::size_t Dataplex::Stack<T, Container>::size() const
+{
+    return _container.size();
+}
+
+template<typename T, typename Container>
+bool Dataplex::Stack<T, Container>::is_empty() const
+{
+    return _container.is_empty();
+}
@@ -9,6 +9,7 @@ http://inversepalindrome.com
 
 #include <cstddef>
 #include <iterator>
+#include <stdexcept>
 
 
 namespace Dataplex
@@ -16,11 +17,11 @@ namespace Dataplex
     template<typename T, std::size_t N>
     struct StaticArray
     {
-        T* begin();
-        const T* begin() const;
+        constexpr T* begin();
+        constexpr const T* begin() const;
 
-        T* end();
-        const T* end() const;
+        constexpr T* end();
+        constexpr const T* end() const;
 
         std::reverse_iterator<T*> rbegin();
         std::reverse_iterator<const T*> rbegin() const;
@@ -28,36 +29,36 @@ namespace Dataplex
         std::reverse_iterator<T*> rend();
         std::reverse_iterator<const T*> rend() const;
 
-        T& operator[](std::size_t index);
-        const T& operator[](std::size_t index) const;
+        constexpr T& operator[](std::size_t index);
+        constexpr const T& operator[](std::size_t index) const;
 
-        std::size_t size() const;
-        bool is_empty() const;
+        constexpr std::size_t size() const;
+        constexpr bool is_empty() const;
 
         T _array[N];
     };
 }
 
 template<typename T, std::size_t N>
-T* Dataplex::StaticArray<T, N>::begin()
+constexpr T* Dataplex::StaticArray<T, N>::begin()
 {
     return _array;
 }
 
 template<typename T, std::size_t N>
-const T* Dataplex::StaticArray<T, N>::begin() const
+constexpr const T* Dataplex::StaticArray<T, N>::begin() const
 {
     return _array;
 }
 
 template<typename T, std::size_t N>
-T* Dataplex::StaticArray<T, N>::end()
+constexpr T* Dataplex::StaticArray<T, N>::end()
 {
     return _array + N;
 }
 
 template<typename T, std::size_t N>
-const T* Dataplex::StaticArray<T, N>::end() const
+constexpr const T* Dataplex::StaticArray<T, N>::end() const
 {
     return _array + N;
 }
@@ -87,7 +88,7 @@ std::reverse_iterator<const T*> Dataplex::StaticArray<T, N>::rend() const
 }
 
 template<typename T, std::size_t N>
-T& Dataplex::StaticArray<T, N>::operator[](std::size_t index)
+constexpr T& Dataplex::StaticArray<T, N>::operator[](std::size_t index)
 {
     if (index >= N)
     {
@@ -98,7 +99,7 @@ T& Dataplex::StaticArray<T, N>::operator[](std::size_t index)
 }
 
 template<typename T, std::size_t N>
-const T& Dataplex::StaticArray<T, N>::operator[](std::size_t index) const
+constexpr const T& Dataplex::StaticArray<T, N>::operator[](std::size_t index) const
 {
     if (index >= N)
     {
@@ -109,13 +110,13 @@ const T& Dataplex::StaticArray<T, N>::operator[](std::size_t index) const
 }
 
 template<typename T, std::size_t N>
-std::size_t Dataplex::StaticArray<T, N>::size() const
+constexpr std::size_t Dataplex::StaticArray<T, N>::size() const
 {
     return N;
 }
 
 template<typename T, std::size_t N>
-bool Dataplex::StaticArray<T, N>::is_empty() const
+constexpr bool Dataplex::StaticArray<T, N>::is_empty() const
 {
     return N == 0;
 }
\ No newline at end of file
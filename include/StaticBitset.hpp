@@ -0,0 +1,241 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - StaticBitset.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "StaticArray.hpp"
+#include "BitOperations.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace Dataplex
+{
+    template<std::size_t N>
+    class StaticBitset
+    {
+    public:
+        static constexpr std::size_t WordCount = N > 0 ? detail::word_count(N) : 1;
+
+        StaticBitset();
+
+        bool operator[](std::size_t pos) const;
+        bool test(std::size_t pos) const;
+
+        void set(std::size_t pos, bool value = true);
+        void reset(std::size_t pos);
+        void flip(std::size_t pos);
+
+        void set_all();
+        void reset_all();
+        void flip_all();
+
+        StaticBitset<N>& operator&=(const StaticBitset<N>& bitset);
+        StaticBitset<N>& operator|=(const StaticBitset<N>& bitset);
+        StaticBitset<N>& operator^=(const StaticBitset<N>& bitset);
+        StaticBitset<N>& and_not(const StaticBitset<N>& bitset);
+
+        bool operator==(const StaticBitset<N>& bitset) const;
+        bool operator!=(const StaticBitset<N>& bitset) const;
+
+        std::size_t count() const;
+        bool all() const;
+        bool any() const;
+        bool none() const;
+
+        std::size_t find_first() const;
+        std::size_t find_next(std::size_t pos) const;
+
+        const StaticArray<std::uint64_t, WordCount>& words() const;
+
+        std::size_t size() const;
+
+    private:
+        StaticArray<std::uint64_t, WordCount> _words;
+
+        void check_position(std::size_t pos) const;
+    };
+}
+
+template<std::size_t N>
+Dataplex::StaticBitset<N>::StaticBitset() :
+    _words{}
+{
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::operator[](std::size_t pos) const
+{
+    return (_words._array[pos / detail::WordBits] >> (pos % detail::WordBits)) & 1;
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::test(std::size_t pos) const
+{
+    check_position(pos);
+
+    return (*this)[pos];
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::set(std::size_t pos, bool value)
+{
+    check_position(pos);
+
+    auto& word = _words._array[pos / detail::WordBits];
+    auto mask = std::uint64_t(1) << (pos % detail::WordBits);
+
+    word = value ? word | mask : word & ~mask;
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::reset(std::size_t pos)
+{
+    set(pos, false);
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::flip(std::size_t pos)
+{
+    check_position(pos);
+
+    _words._array[pos / detail::WordBits] ^= std::uint64_t(1) << (pos % detail::WordBits);
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::set_all()
+{
+    std::fill(_words.begin(), _words.end(), ~std::uint64_t(0));
+
+    _words._array[WordCount - 1] &= N > 0 ? detail::tail_mask(N) : 0;
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::reset_all()
+{
+    std::fill(_words.begin(), _words.end(), 0);
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::flip_all()
+{
+    for (auto& word : _words)
+    {
+        word = ~word;
+    }
+
+    _words._array[WordCount - 1] &= N > 0 ? detail::tail_mask(N) : 0;
+}
+
+template<std::size_t N>
+Dataplex::StaticBitset<N>& Dataplex::StaticBitset<N>::operator&=(const StaticBitset<N>& bitset)
+{
+    detail::combine_words<detail::BitOperation::And>(_words.begin(), bitset._words.begin(), WordCount);
+
+    return *this;
+}
+
+template<std::size_t N>
+Dataplex::StaticBitset<N>& Dataplex::StaticBitset<N>::operator|=(const StaticBitset<N>& bitset)
+{
+    detail::combine_words<detail::BitOperation::Or>(_words.begin(), bitset._words.begin(), WordCount);
+
+    return *this;
+}
+
+template<std::size_t N>
+Dataplex::StaticBitset<N>& Dataplex::StaticBitset<N>::operator^=(const StaticBitset<N>& bitset)
+{
+    detail::combine_words<detail::BitOperation::Xor>(_words.begin(), bitset._words.begin(), WordCount);
+
+    return *this;
+}
+
+template<std::size_t N>
+Dataplex::StaticBitset<N>& Dataplex::StaticBitset<N>::and_not(const StaticBitset<N>& bitset)
+{
+    detail::combine_words<detail::BitOperation::AndNot>(_words.begin(), bitset._words.begin(), WordCount);
+
+    return *this;
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::operator==(const StaticBitset<N>& bitset) const
+{
+    return std::equal(_words.begin(), _words.end(), bitset._words.begin());
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::operator!=(const StaticBitset<N>& bitset) const
+{
+    return !(*this == bitset);
+}
+
+template<std::size_t N>
+std::size_t Dataplex::StaticBitset<N>::count() const
+{
+    return detail::popcount_words(_words.begin(), WordCount);
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::all() const
+{
+    return count() == N;
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::any() const
+{
+    return std::any_of(_words.begin(), _words.end(), [](auto word) { return word != 0; });
+}
+
+template<std::size_t N>
+bool Dataplex::StaticBitset<N>::none() const
+{
+    return !any();
+}
+
+template<std::size_t N>
+std::size_t Dataplex::StaticBitset<N>::find_first() const
+{
+    return std::min(detail::find_next_word_bit(_words.begin(), WordCount, 0), N);
+}
+
+template<std::size_t N>
+std::size_t Dataplex::StaticBitset<N>::find_next(std::size_t pos) const
+{
+    if (pos + 1 >= N)
+    {
+        return N;
+    }
+
+    return std::min(detail::find_next_word_bit(_words.begin(), WordCount, pos + 1), N);
+}
+
+template<std::size_t N>
+const Dataplex::StaticArray<std::uint64_t, Dataplex::StaticBitset<N>::WordCount>& Dataplex::StaticBitset<N>::words() const
+{
+    return _words;
+}
+
+template<std::size_t N>
+std::size_t Dataplex::StaticBitset<N>::size() const
+{
+    return N;
+}
+
+template<std::size_t N>
+void Dataplex::StaticBitset<N>::check_position(std::size_t pos) const
+{
+    if (pos >= N)
+    {
+        throw std::out_of_range("Bit position out of range!");
+    }
+}
@@ -0,0 +1,479 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - StringPool.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Hash.hpp"
+#include "DynamicArray.hpp"
+
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+
+namespace Dataplex
+{
+    class StringPool
+    {
+    public:
+        using Handle = std::uint32_t;
+
+        static constexpr Handle InvalidHandle = UINT32_MAX;
+        static constexpr std::size_t ChunkSize = std::size_t(1) << 20;
+
+        explicit StringPool(bool deduplicate = false);
+        StringPool(const StringPool& pool);
+        StringPool& operator=(const StringPool& pool);
+        StringPool(StringPool&& pool);
+        StringPool& operator=(StringPool&& pool);
+
+        std::string_view operator[](Handle handle) const;
+
+        class ConstIterator;
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        Handle insert(std::string_view string);
+        Handle find(std::string_view string) const;
+        bool contains(std::string_view string) const;
+
+        void clear();
+        void shrink_to_fit();
+
+        std::size_t size() const;
+        std::size_t byte_size() const;
+        bool is_empty() const;
+        bool is_deduplicating() const;
+
+    private:
+        static constexpr std::size_t ChunkBits = 20;
+
+        DynamicArray<std::unique_ptr<char[]>> _chunks;
+        DynamicArray<std::size_t> _fills;
+        DynamicArray<Handle> _index;
+        std::size_t _current;
+        std::size_t _size;
+        bool _deduplicate;
+
+        Handle append(std::string_view string);
+        std::size_t find_slot(std::string_view string, std::size_t hash) const;
+        void rehash(std::size_t capacity);
+
+        void swap(StringPool& pool);
+
+        static std::size_t encoded_size(std::size_t size);
+        static std::string_view decode(const char* entry, std::size_t& length);
+
+    public:
+        class ConstIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = std::string_view;
+
+            ConstIterator(const StringPool* pool, std::size_t chunk, std::size_t offset);
+
+            ConstIterator& operator++();
+            ConstIterator operator++(int);
+
+            std::string_view operator*() const;
+
+            Handle handle() const;
+
+            bool operator==(const ConstIterator& iterator) const;
+            bool operator!=(const ConstIterator& iterator) const;
+
+        private:
+            const StringPool* _pool;
+            std::size_t _chunk;
+            std::size_t _offset;
+
+            void skip_exhausted();
+        };
+    };
+}
+
+inline Dataplex::StringPool::StringPool(bool deduplicate) :
+    _chunks(),
+    _fills(),
+    _index(),
+    _current(0),
+    _size(0),
+    _deduplicate(deduplicate)
+{
+}
+
+inline Dataplex::StringPool::StringPool(const StringPool& pool) :
+    StringPool(pool._deduplicate)
+{
+    for (std::size_t i = 0; i < pool._chunks.size(); ++i)
+    {
+        std::unique_ptr<char[]> chunk(new char[ChunkSize]);
+
+        std::memcpy(chunk.get(), pool._chunks[i].get(), pool._fills[i]);
+
+        _chunks.push_back(std::move(chunk));
+        _fills.push_back(pool._fills[i]);
+    }
+
+    for (std::size_t i = 0; i < pool._index.size(); ++i)
+    {
+        _index.push_back(pool._index[i]);
+    }
+
+    _current = pool._current;
+    _size = pool._size;
+}
+
+inline Dataplex::StringPool& Dataplex::StringPool::operator=(const StringPool& pool)
+{
+    StringPool temp(pool);
+    swap(temp);
+
+    return *this;
+}
+
+inline Dataplex::StringPool::StringPool(StringPool&& pool) :
+    StringPool(pool._deduplicate)
+{
+    swap(pool);
+}
+
+inline Dataplex::StringPool& Dataplex::StringPool::operator=(StringPool&& pool)
+{
+    swap(pool);
+
+    return *this;
+}
+
+inline std::string_view Dataplex::StringPool::operator[](Handle handle) const
+{
+    auto chunk = static_cast<std::size_t>(handle) >> ChunkBits;
+    auto offset = static_cast<std::size_t>(handle) & (ChunkSize - 1);
+
+    if (chunk >= _chunks.size() || offset >= _fills[chunk])
+    {
+        throw std::out_of_range("String handle out of range!");
+    }
+
+    std::size_t length = 0;
+
+    return decode(_chunks[chunk].get() + offset, length);
+}
+
+inline Dataplex::StringPool::ConstIterator Dataplex::StringPool::begin() const
+{
+    return ConstIterator(this, 0, 0);
+}
+
+inline Dataplex::StringPool::ConstIterator Dataplex::StringPool::end() const
+{
+    return ConstIterator(this, _chunks.size(), 0);
+}
+
+inline Dataplex::StringPool::Handle Dataplex::StringPool::insert(std::string_view string)
+{
+    if (!_deduplicate)
+    {
+        return append(string);
+    }
+
+    if ((_size + 1) * 4 > _index.size() * 3)
+    {
+        rehash(_index.is_empty() ? 16 : _index.size() * 2);
+    }
+
+    auto hash = static_cast<std::size_t>(hash::hash_bytes(string.data(), string.size()));
+    auto slot = find_slot(string, hash);
+
+    if (_index[slot] == InvalidHandle)
+    {
+        _index[slot] = append(string);
+    }
+
+    return _index[slot];
+}
+
+inline Dataplex::StringPool::Handle Dataplex::StringPool::find(std::string_view string) const
+{
+    if (!_deduplicate)
+    {
+        throw std::logic_error("Can't find strings in a pool without deduplication!");
+    }
+
+    if (_index.is_empty())
+    {
+        return InvalidHandle;
+    }
+
+    auto hash = static_cast<std::size_t>(hash::hash_bytes(string.data(), string.size()));
+
+    return _index[find_slot(string, hash)];
+}
+
+inline bool Dataplex::StringPool::contains(std::string_view string) const
+{
+    return find(string) != InvalidHandle;
+}
+
+inline void Dataplex::StringPool::clear()
+{
+    for (std::size_t i = 0; i < _fills.size(); ++i)
+    {
+        _fills[i] = 0;
+    }
+
+    for (std::size_t i = 0; i < _index.size(); ++i)
+    {
+        _index[i] = InvalidHandle;
+    }
+
+    _current = 0;
+    _size = 0;
+}
+
+inline void Dataplex::StringPool::shrink_to_fit()
+{
+    while (!_chunks.is_empty() && _fills.tail() == 0)
+    {
+        _chunks.pop_back();
+        _fills.pop_back();
+    }
+
+    _current = _chunks.is_empty() ? 0 : _chunks.size() - 1;
+
+    if (_deduplicate && _size == 0)
+    {
+        _index = DynamicArray<Handle>();
+    }
+}
+
+inline std::size_t Dataplex::StringPool::size() const
+{
+    return _size;
+}
+
+inline std::size_t Dataplex::StringPool::byte_size() const
+{
+    std::size_t bytes = 0;
+
+    for (std::size_t i = 0; i < _fills.size(); ++i)
+    {
+        bytes += _fills[i];
+    }
+
+    return bytes;
+}
+
+inline bool Dataplex::StringPool::is_empty() const
+{
+    return _size == 0;
+}
+
+inline bool Dataplex::StringPool::is_deduplicating() const
+{
+    return _deduplicate;
+}
+
+inline Dataplex::StringPool::Handle Dataplex::StringPool::append(std::string_view string)
+{
+    auto entrySize = encoded_size(string.size()) + string.size();
+
+    if (entrySize > ChunkSize)
+    {
+        throw std::length_error("String too long for string pool chunk!");
+    }
+
+    while (_current < _chunks.size() && _fills[_current] + entrySize > ChunkSize)
+    {
+        ++_current;
+    }
+
+    if (_current == _chunks.size())
+    {
+        if (((_current + 1) << ChunkBits) - 1 >= InvalidHandle)
+        {
+            throw std::overflow_error("String pool exceeded handle range!");
+        }
+
+        _chunks.push_back(std::unique_ptr<char[]>(new char[ChunkSize]));
+        _fills.push_back(0);
+    }
+
+    auto offset = _fills[_current];
+    auto* entry = _chunks[_current].get() + offset;
+
+    auto length = string.size();
+
+    while (length >= 0x80)
+    {
+        *entry++ = static_cast<char>((length & 0x7F) | 0x80);
+        length >>= 7;
+    }
+
+    *entry++ = static_cast<char>(length);
+
+    std::memcpy(entry, string.data(), string.size());
+
+    _fills[_current] += entrySize;
+    ++_size;
+
+    return static_cast<Handle>((_current << ChunkBits) | offset);
+}
+
+inline std::size_t Dataplex::StringPool::find_slot(std::string_view string, std::size_t hash) const
+{
+    auto mask = _index.size() - 1;
+    auto slot = hash & mask;
+
+    while (_index[slot] != InvalidHandle && (*this)[_index[slot]] != string)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+inline void Dataplex::StringPool::rehash(std::size_t capacity)
+{
+    DynamicArray<Handle> index;
+    index.resize(capacity);
+
+    for (std::size_t i = 0; i < capacity; ++i)
+    {
+        index[i] = InvalidHandle;
+    }
+
+    for (std::size_t i = 0; i < _index.size(); ++i)
+    {
+        if (_index[i] != InvalidHandle)
+        {
+            auto string = (*this)[_index[i]];
+            auto slot = static_cast<std::size_t>(hash::hash_bytes(string.data(), string.size())) & (capacity - 1);
+
+            while (index[slot] != InvalidHandle)
+            {
+                slot = (slot + 1) & (capacity - 1);
+            }
+
+            index[slot] = _index[i];
+        }
+    }
+
+    _index = std::move(index);
+}
+
+inline void Dataplex::StringPool::swap(StringPool& pool)
+{
+    std::swap(_chunks, pool._chunks);
+    std::swap(_fills, pool._fills);
+    std::swap(_index, pool._index);
+    std::swap(_current, pool._current);
+    std::swap(_size, pool._size);
+    std::swap(_deduplicate, pool._deduplicate);
+}
+
+inline std::size_t Dataplex::StringPool::encoded_size(std::size_t size)
+{
+    std::size_t bytes = 1;
+
+    while (size >= 0x80)
+    {
+        size >>= 7;
+        ++bytes;
+    }
+
+    return bytes;
+}
+
+inline std::string_view Dataplex::StringPool::decode(const char* entry, std::size_t& length)
+{
+    std::size_t size = 0;
+    std::size_t shift = 0;
+    std::size_t bytes = 0;
+
+    std::uint8_t byte = 0;
+
+    do
+    {
+        byte = static_cast<std::uint8_t>(entry[bytes++]);
+        size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    length = bytes + size;
+
+    return std::string_view(entry + bytes, size);
+}
+
+inline Dataplex::StringPool::ConstIterator::ConstIterator(const StringPool* pool, std::size_t chunk, std::size_t offset) :
+    _pool(pool),
+    _chunk(chunk),
+    _offset(offset)
+{
+    skip_exhausted();
+}
+
+inline Dataplex::StringPool::ConstIterator& Dataplex::StringPool::ConstIterator::operator++()
+{
+    std::size_t length = 0;
+
+    decode(_pool->_chunks[_chunk].get() + _offset, length);
+
+    _offset += length;
+
+    skip_exhausted();
+
+    return *this;
+}
+
+inline Dataplex::StringPool::ConstIterator Dataplex::StringPool::ConstIterator::operator++(int)
+{
+    auto temp = *this;
+
+    ++(*this);
+
+    return temp;
+}
+
+inline std::string_view Dataplex::StringPool::ConstIterator::operator*() const
+{
+    std::size_t length = 0;
+
+    return decode(_pool->_chunks[_chunk].get() + _offset, length);
+}
+
+inline Dataplex::StringPool::Handle Dataplex::StringPool::ConstIterator::handle() const
+{
+    return static_cast<Handle>((_chunk << ChunkBits) | _offset);
+}
+
+inline bool Dataplex::StringPool::ConstIterator::operator==(const ConstIterator& iterator) const
+{
+    return _chunk == iterator._chunk && _offset == iterator._offset;
+}
+
+inline bool Dataplex::StringPool::ConstIterator::operator!=(const ConstIterator& iterator) const
+{
+    return !(*this == iterator);
+}
+
+inline void Dataplex::StringPool::ConstIterator::skip_exhausted()
+{
+    while (_chunk < _pool->_chunks.size() && _offset >= _pool->_fills[_chunk])
+    {
+        ++_chunk;
+        _offset = 0;
+    }
+}
@@ -0,0 +1,462 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ThreadPool.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Queue.hpp"
+#include "DynamicArray.hpp"
+#include "WorkStealingDeque.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include <type_traits>
+#include <condition_variable>
+
+
+namespace Dataplex
+{
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+        ThreadPool(const ThreadPool& pool) = delete;
+        ThreadPool& operator=(const ThreadPool& pool) = delete;
+
+        ~ThreadPool();
+
+        static ThreadPool& global();
+
+        template<typename Function>
+        auto submit(Function&& function) -> std::future<decltype(function())>;
+
+        template<typename Left, typename Right>
+        void fork_join(Left&& left, Right&& right);
+
+        template<typename Function>
+        void parallel_for(std::size_t begin, std::size_t end, std::size_t grainSize, const Function& function);
+
+        std::size_t thread_count() const;
+        std::size_t default_grain_size(std::size_t size) const;
+
+    private:
+        class Task
+        {
+        public:
+            virtual ~Task() = default;
+
+            virtual void execute() = 0;
+        };
+
+        template<typename Function>
+        class JoinTask : public Task
+        {
+        public:
+            explicit JoinTask(Function& function);
+
+            void execute() override;
+
+            bool is_done() const;
+            void rethrow() const;
+
+        private:
+            Function& _function;
+            std::atomic<bool> _done;
+            std::exception_ptr _exception;
+        };
+
+        template<typename Result>
+        class FutureTask : public Task
+        {
+        public:
+            template<typename Function>
+            explicit FutureTask(Function&& function);
+
+            void execute() override;
+
+            std::future<Result> get_future();
+
+        private:
+            std::packaged_task<Result()> _task;
+        };
+
+        struct Worker
+        {
+            WorkStealingDeque<Task*> deque;
+            std::thread thread;
+        };
+
+        struct Context
+        {
+            ThreadPool* pool;
+            Worker* worker;
+            std::uint64_t seed;
+        };
+
+        DynamicArray<std::unique_ptr<Worker>> _workers;
+
+        std::mutex _injectionMutex;
+        Queue<Task*> _injection;
+        std::atomic<std::size_t> _injectionSize;
+
+        std::mutex _sleepMutex;
+        std::condition_variable _wakeup;
+        std::atomic<std::uint64_t> _epoch;
+        std::atomic<std::size_t> _sleepers;
+        bool _stopping;
+
+        static Context& context();
+        static std::uint64_t next_random(std::uint64_t& seed);
+
+        Worker* current_worker() const;
+
+        void run(Worker* worker);
+        void schedule(Task* task);
+        void notify();
+
+        Task* find_task(Worker* worker);
+
+        template<typename Function>
+        void wait(const JoinTask<Function>& task);
+    };
+}
+
+inline Dataplex::ThreadPool::ThreadPool(std::size_t threadCount) :
+    _injectionSize(0),
+    _epoch(0),
+    _sleepers(0),
+    _stopping(false)
+{
+    threadCount = std::max<std::size_t>(threadCount, 1);
+
+    _workers.reserve(threadCount);
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+
+    for (auto& worker : _workers)
+    {
+        auto workerPtr = worker.get();
+        worker->thread = std::thread([this, workerPtr]() { run(workerPtr); });
+    }
+}
+
+inline Dataplex::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+
+    _wakeup.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        worker->thread.join();
+    }
+}
+
+inline Dataplex::ThreadPool& Dataplex::ThreadPool::global()
+{
+    static ThreadPool pool;
+
+    return pool;
+}
+
+template<typename Function>
+auto Dataplex::ThreadPool::submit(Function&& function) -> std::future<decltype(function())>
+{
+    using Result = decltype(function());
+
+    auto task = new FutureTask<Result>(std::forward<Function>(function));
+    auto future = task->get_future();
+
+    schedule(task);
+
+    return future;
+}
+
+template<typename Left, typename Right>
+void Dataplex::ThreadPool::fork_join(Left&& left, Right&& right)
+{
+    JoinTask<std::remove_reference_t<Right>> task(right);
+    schedule(&task);
+
+    std::exception_ptr exception;
+
+    try
+    {
+        left();
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    wait(task);
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    task.rethrow();
+}
+
+template<typename Function>
+void Dataplex::ThreadPool::parallel_for(std::size_t begin, std::size_t end, std::size_t grainSize, const Function& function)
+{
+    grainSize = std::max<std::size_t>(grainSize, 1);
+
+    if (end - begin <= grainSize)
+    {
+        if (begin < end)
+        {
+            function(begin, end);
+        }
+
+        return;
+    }
+
+    auto middle = begin + (end - begin) / 2;
+
+    fork_join([&]() { parallel_for(begin, middle, grainSize, function); },
+        [&]() { parallel_for(middle, end, grainSize, function); });
+}
+
+inline std::size_t Dataplex::ThreadPool::thread_count() const
+{
+    return _workers.size();
+}
+
+inline std::size_t Dataplex::ThreadPool::default_grain_size(std::size_t size) const
+{
+    return std::max<std::size_t>(size / (thread_count() * 8), 1);
+}
+
+inline Dataplex::ThreadPool::Context& Dataplex::ThreadPool::context()
+{
+    static thread_local Context context{ nullptr, nullptr,
+        std::hash<std::thread::id>()(std::this_thread::get_id()) | 1 };
+
+    return context;
+}
+
+inline std::uint64_t Dataplex::ThreadPool::next_random(std::uint64_t& seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return seed;
+}
+
+inline Dataplex::ThreadPool::Worker* Dataplex::ThreadPool::current_worker() const
+{
+    auto& current = context();
+
+    return current.pool == this ? current.worker : nullptr;
+}
+
+inline void Dataplex::ThreadPool::run(Worker* worker)
+{
+    auto& current = context();
+    current.pool = this;
+    current.worker = worker;
+
+    const std::size_t spinLimit = 64;
+    std::size_t spins = 0;
+
+    while (true)
+    {
+        auto epoch = _epoch.load();
+
+        if (auto task = find_task(worker))
+        {
+            task->execute();
+            spins = 0;
+
+            continue;
+        }
+
+        if (++spins < spinLimit)
+        {
+            std::this_thread::yield();
+
+            continue;
+        }
+
+        spins = 0;
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+
+        if (_stopping)
+        {
+            return;
+        }
+
+        _sleepers.fetch_add(1);
+        _wakeup.wait(lock, [this, epoch]() { return _stopping || _epoch.load() != epoch; });
+        _sleepers.fetch_sub(1);
+    }
+}
+
+inline void Dataplex::ThreadPool::schedule(Task* task)
+{
+    if (auto worker = current_worker())
+    {
+        worker->deque.push(task);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(_injectionMutex);
+        _injection.push(task);
+        _injectionSize.fetch_add(1);
+    }
+
+    notify();
+}
+
+inline void Dataplex::ThreadPool::notify()
+{
+    _epoch.fetch_add(1);
+
+    if (_sleepers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _wakeup.notify_one();
+    }
+}
+
+inline Dataplex::ThreadPool::Task* Dataplex::ThreadPool::find_task(Worker* worker)
+{
+    if (worker)
+    {
+        Task* task;
+
+        if (worker->deque.try_pop(task))
+        {
+            return task;
+        }
+    }
+
+    if (_injectionSize.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(_injectionMutex);
+
+        Task* task;
+
+        if (_injection.try_pop(task))
+        {
+            _injectionSize.fetch_sub(1);
+
+            return task;
+        }
+    }
+
+    auto count = _workers.size();
+    auto start = static_cast<std::size_t>(next_random(context().seed) % count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto victim = _workers[(start + i) % count].get();
+
+        Task* task;
+
+        if (victim != worker && victim->deque.try_steal(task))
+        {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename Function>
+void Dataplex::ThreadPool::wait(const JoinTask<Function>& task)
+{
+    auto worker = current_worker();
+
+    while (!task.is_done())
+    {
+        if (auto next = find_task(worker))
+        {
+            next->execute();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<typename Function>
+Dataplex::ThreadPool::JoinTask<Function>::JoinTask(Function& function) :
+    _function(function),
+    _done(false)
+{
+}
+
+template<typename Function>
+void Dataplex::ThreadPool::JoinTask<Function>::execute()
+{
+    try
+    {
+        _function();
+    }
+    catch (...)
+    {
+        _exception = std::current_exception();
+    }
+
+    _done.store(true, std::memory_order_release);
+}
+
+template<typename Function>
+bool Dataplex::ThreadPool::JoinTask<Function>::is_done() const
+{
+    return _done.load(std::memory_order_acquire);
+}
+
+template<typename Function>
+void Dataplex::ThreadPool::JoinTask<Function>::rethrow() const
+{
+    if (_exception)
+    {
+        std::rethrow_exception(_exception);
+    }
+}
+
+template<typename Result>
+template<typename Function>
+Dataplex::ThreadPool::FutureTask<Result>::FutureTask(Function&& function) :
+    _task(std::forward<Function>(function))
+{
+}
+
+template<typename Result>
+void Dataplex::ThreadPool::FutureTask<Result>::execute()
+{
+    _task();
+
+    delete this;
+}
+
+template<typename Result>
+std::future<Result> Dataplex::ThreadPool::FutureTask<Result>::get_future()
+{
+    return _task.get_future();
+}
@@ -0,0 +1,492 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - TimerWheel.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "StaticArray.hpp"
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+
+
+namespace Dataplex
+{
+    template<typename T>
+    class TimerWheel
+    {
+    public:
+        using Handle = std::uint64_t;
+
+        TimerWheel();
+        explicit TimerWheel(std::uint64_t now);
+
+        Handle schedule(std::uint64_t delay, const T& data);
+        Handle schedule(std::uint64_t delay, T&& data);
+        bool reschedule(Handle handle, std::uint64_t delay);
+        bool cancel(Handle handle);
+
+        template<typename Callback>
+        std::size_t advance(std::uint64_t ticks, Callback callback);
+
+        bool contains(Handle handle) const;
+        std::uint64_t deadline(Handle handle) const;
+
+        std::uint64_t now() const;
+        std::uint64_t next_event() const;
+
+        void clear();
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+    private:
+        static constexpr std::size_t SlotBits = 6;
+        static constexpr std::size_t Slots = std::size_t(1) << SlotBits;
+        static constexpr std::size_t Levels = 11;
+        static constexpr std::uint32_t Nil = UINT32_MAX;
+
+        struct Node
+        {
+            Node() = default;
+            Node(const Node& node) = default;
+            Node& operator=(const Node& node);
+            Node(Node&& node) = default;
+            Node& operator=(Node&& node);
+
+            std::optional<T> data;
+            std::uint64_t deadline = 0;
+            std::uint32_t prev = Nil;
+            std::uint32_t next = Nil;
+            std::uint32_t generation = 0;
+            std::uint16_t bucket = 0;
+            bool active = false;
+        };
+
+        DynamicArray<Node> _nodes;
+        StaticArray<std::uint32_t, Levels * Slots> _heads;
+        StaticArray<std::uint64_t, Levels> _occupied;
+
+        std::uint64_t _now;
+        std::uint32_t _free;
+        std::size_t _size;
+
+        template<typename U>
+        Handle insert(std::uint64_t delay, U&& data);
+
+        std::uint32_t acquire();
+        void release(std::uint32_t index);
+
+        void place(std::uint32_t index);
+        void link(std::uint32_t index, std::size_t bucket);
+        void unlink(std::uint32_t index);
+
+        std::uint32_t find(Handle handle) const;
+
+        static std::uint64_t deadline_after(std::uint64_t now, std::uint64_t delay);
+    };
+}
+
+template<typename T>
+Dataplex::TimerWheel<T>::TimerWheel() :
+    TimerWheel(0)
+{
+}
+
+template<typename T>
+Dataplex::TimerWheel<T>::TimerWheel(std::uint64_t now) :
+    _nodes(),
+    _heads(),
+    _occupied(),
+    _now(now),
+    _free(Nil),
+    _size(0)
+{
+    for (auto& head : _heads)
+    {
+        head = Nil;
+    }
+
+    for (auto& occupied : _occupied)
+    {
+        occupied = 0;
+    }
+}
+
+template<typename T>
+typename Dataplex::TimerWheel<T>::Handle Dataplex::TimerWheel<T>::schedule(std::uint64_t delay, const T& data)
+{
+    return insert(delay, data);
+}
+
+template<typename T>
+typename Dataplex::TimerWheel<T>::Handle Dataplex::TimerWheel<T>::schedule(std::uint64_t delay, T&& data)
+{
+    return insert(delay, std::move(data));
+}
+
+template<typename T>
+bool Dataplex::TimerWheel<T>::reschedule(Handle handle, std::uint64_t delay)
+{
+    auto index = find(handle);
+
+    if (index == Nil)
+    {
+        return false;
+    }
+
+    unlink(index);
+
+    _nodes[index].deadline = deadline_after(_now, delay);
+
+    place(index);
+
+    return true;
+}
+
+template<typename T>
+bool Dataplex::TimerWheel<T>::cancel(Handle handle)
+{
+    auto index = find(handle);
+
+    if (index == Nil)
+    {
+        return false;
+    }
+
+    unlink(index);
+    release(index);
+
+    return true;
+}
+
+template<typename T>
+template<typename Callback>
+std::size_t Dataplex::TimerWheel<T>::advance(std::uint64_t ticks, Callback callback)
+{
+    auto target = ticks > UINT64_MAX - _now ? UINT64_MAX : _now + ticks;
+
+    std::size_t expired = 0;
+
+    while (_size > 0)
+    {
+        auto next = next_event();
+
+        if (next > target)
+        {
+            break;
+        }
+
+        _now = next;
+
+        for (auto level = Levels - 1; level > 0; --level)
+        {
+            if ((_now & ((std::uint64_t(1) << (SlotBits * level)) - 1)) != 0)
+            {
+                continue;
+            }
+
+            auto bucket = level * Slots + ((_now >> (SlotBits * level)) & (Slots - 1));
+
+            while (_heads[bucket] != Nil)
+            {
+                auto index = _heads[bucket];
+
+                unlink(index);
+                place(index);
+            }
+        }
+
+        auto bucket = _now & (Slots - 1);
+
+        while (_heads[bucket] != Nil)
+        {
+            auto index = _heads[bucket];
+
+            unlink(index);
+
+            auto data = std::move(*_nodes[index].data);
+
+            release(index);
+
+            callback(data);
+
+            ++expired;
+        }
+    }
+
+    _now = target;
+
+    return expired;
+}
+
+template<typename T>
+bool Dataplex::TimerWheel<T>::contains(Handle handle) const
+{
+    return find(handle) != Nil;
+}
+
+template<typename T>
+std::uint64_t Dataplex::TimerWheel<T>::deadline(Handle handle) const
+{
+    auto index = find(handle);
+
+    if (index == Nil)
+    {
+        throw std::out_of_range("Timer not scheduled!");
+    }
+
+    return _nodes[index].deadline;
+}
+
+template<typename T>
+std::uint64_t Dataplex::TimerWheel<T>::now() const
+{
+    return _now;
+}
+
+template<typename T>
+std::uint64_t Dataplex::TimerWheel<T>::next_event() const
+{
+    auto next = UINT64_MAX;
+
+    for (std::size_t level = 0; level < Levels; ++level)
+    {
+        if (_occupied[level] == 0)
+        {
+            continue;
+        }
+
+        auto shift = SlotBits * level;
+        auto slot = static_cast<std::uint64_t>(detail::count_trailing_zeros(_occupied[level]));
+        auto block = level + 1 < Levels ? (_now >> (shift + SlotBits)) << (shift + SlotBits) : 0;
+        auto time = block | (slot << shift);
+
+        if (time < next)
+        {
+            next = time;
+        }
+    }
+
+    return next;
+}
+
+template<typename T>
+void Dataplex::TimerWheel<T>::clear()
+{
+    for (std::size_t bucket = 0; bucket < Levels * Slots; ++bucket)
+    {
+        while (_heads[bucket] != Nil)
+        {
+            auto index = _heads[bucket];
+
+            unlink(index);
+            release(index);
+        }
+    }
+}
+
+template<typename T>
+std::size_t Dataplex::TimerWheel<T>::size() const
+{
+    return _size;
+}
+
+template<typename T>
+bool Dataplex::TimerWheel<T>::is_empty() const
+{
+    return _size == 0;
+}
+
+template<typename T>
+template<typename U>
+typename Dataplex::TimerWheel<T>::Handle Dataplex::TimerWheel<T>::insert(std::uint64_t delay, U&& data)
+{
+    auto index = acquire();
+    auto& node = _nodes[index];
+
+    node.data.emplace(std::forward<U>(data));
+    node.deadline = deadline_after(_now, delay);
+    node.active = true;
+
+    place(index);
+
+    ++_size;
+
+    return (static_cast<Handle>(node.generation) << 32) | index;
+}
+
+template<typename T>
+std::uint32_t Dataplex::TimerWheel<T>::acquire()
+{
+    if (_free != Nil)
+    {
+        auto index = _free;
+
+        _free = _nodes[index].next;
+
+        return index;
+    }
+
+    if (_nodes.size() == Nil)
+    {
+        throw std::length_error("Timer wheel exceeded maximum timer count!");
+    }
+
+    _nodes.emplace_back();
+
+    return static_cast<std::uint32_t>(_nodes.size() - 1);
+}
+
+template<typename T>
+void Dataplex::TimerWheel<T>::release(std::uint32_t index)
+{
+    auto& node = _nodes[index];
+
+    node.data.reset();
+    node.active = false;
+    node.next = _free;
+
+    ++node.generation;
+
+    _free = index;
+
+    --_size;
+}
+
+template<typename T>
+void Dataplex::TimerWheel<T>::place(std::uint32_t index)
+{
+    auto deadline = _nodes[index].deadline;
+    auto differing = deadline > _now ? deadline ^ _now : 0;
+
+    std::size_t level = 0;
+
+    while (level + 1 < Levels && (differing >> (SlotBits * (level + 1))) != 0)
+    {
+        ++level;
+    }
+
+    auto slot = deadline > _now ? (deadline >> (SlotBits * level)) & (Slots - 1) : _now & (Slots - 1);
+
+    link(index, level * Slots + slot);
+}
+
+template<typename T>
+void Dataplex::TimerWheel<T>::link(std::uint32_t index, std::size_t bucket)
+{
+    auto& node = _nodes[index];
+
+    node.bucket = static_cast<std::uint16_t>(bucket);
+    node.prev = Nil;
+    node.next = _heads[bucket];
+
+    if (node.next != Nil)
+    {
+        _nodes[node.next].prev = index;
+    }
+
+    _heads[bucket] = index;
+    _occupied[bucket / Slots] |= std::uint64_t(1) << (bucket % Slots);
+}
+
+template<typename T>
+void Dataplex::TimerWheel<T>::unlink(std::uint32_t index)
+{
+    auto& node = _nodes[index];
+
+    if (node.prev != Nil)
+    {
+        _nodes[node.prev].next = node.next;
+    }
+    else
+    {
+        _heads[node.bucket] = node.next;
+
+        if (node.next == Nil)
+        {
+            _occupied[node.bucket / Slots] &= ~(std::uint64_t(1) << (node.bucket % Slots));
+        }
+    }
+
+    if (node.next != Nil)
+    {
+        _nodes[node.next].prev = node.prev;
+    }
+
+    node.prev = Nil;
+    node.next = Nil;
+}
+
+template<typename T>
+typename Dataplex::TimerWheel<T>::Node& Dataplex::TimerWheel<T>::Node::operator=(const Node& node)
+{
+    data.reset();
+
+    if (node.data)
+    {
+        data.emplace(*node.data);
+    }
+
+    deadline = node.deadline;
+    prev = node.prev;
+    next = node.next;
+    generation = node.generation;
+    bucket = node.bucket;
+    active = node.active;
+
+    return *this;
+}
+
+template<typename T>
+typename Dataplex::TimerWheel<T>::Node& Dataplex::TimerWheel<T>::Node::operator=(Node&& node)
+{
+    data.reset();
+
+    if (node.data)
+    {
+        data.emplace(std::move(*node.data));
+    }
+
+    deadline = node.deadline;
+    prev = node.prev;
+    next = node.next;
+    generation = node.generation;
+    bucket = node.bucket;
+    active = node.active;
+
+    return *this;
+}
+
+template<typename T>
+std::uint32_t Dataplex::TimerWheel<T>::find(Handle handle) const
+{
+    auto index = static_cast<std::uint32_t>(handle & UINT32_MAX);
+    auto generation = static_cast<std::uint32_t>(handle >> 32);
+
+    if (index >= _nodes.size() || !_nodes[index].active || _nodes[index].generation != generation)
+    {
+        return Nil;
+    }
+
+    return index;
+}
+
+template<typename T>
+std::uint64_t Dataplex::TimerWheel<T>::deadline_after(std::uint64_t now, std::uint64_t delay)
+{
+    if (delay == 0)
+    {
+        delay = 1;
+    }
+
+    return delay > UINT64_MAX - now ? UINT64_MAX : now + delay;
+}
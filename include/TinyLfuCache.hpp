@@ -0,0 +1,739 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - TinyLfuCache.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "Hash.hpp"
+#include "HashMap.hpp"
+#include "DynamicArray.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        class FrequencySketch
+        {
+        public:
+            explicit FrequencySketch(std::size_t capacity);
+
+            void increment(std::uint64_t hash);
+            std::uint32_t frequency(std::uint64_t hash) const;
+
+            void ensure_capacity(std::size_t capacity);
+            void clear();
+
+            std::size_t capacity() const;
+
+        private:
+            static constexpr std::size_t Depth = 4;
+
+            DynamicArray<std::uint64_t> _table;
+            std::size_t _capacity;
+            std::size_t _mask;
+            std::size_t _additions;
+            std::size_t _sampleSize;
+
+            std::size_t counter_index(std::uint64_t hash, std::size_t row) const;
+            void age();
+        };
+    }
+
+    template<typename Key, typename Value, typename Hasher = hash::Hash<Key>>
+    class TinyLfuCache
+    {
+    public:
+        using Weigher = std::function<std::size_t(const Key&, const Value&)>;
+        using EvictionCallback = std::function<void(const Key&, Value&)>;
+
+        explicit TinyLfuCache(std::size_t capacity, Weigher weigher = Weigher(), const Hasher& hasher = Hasher());
+        TinyLfuCache(const TinyLfuCache<Key, Value, Hasher>& cache);
+        TinyLfuCache<Key, Value, Hasher>& operator=(const TinyLfuCache<Key, Value, Hasher>& cache);
+        TinyLfuCache(TinyLfuCache<Key, Value, Hasher>&& cache);
+        TinyLfuCache<Key, Value, Hasher>& operator=(TinyLfuCache<Key, Value, Hasher>&& cache);
+
+        Value* get(const Key& key);
+        const Value* peek(const Key& key) const;
+        bool contains(const Key& key) const;
+
+        bool put(const Key& key, const Value& value);
+        bool put(Key&& key, Value&& value);
+        bool erase(const Key& key);
+
+        void set_eviction_callback(EvictionCallback callback);
+        void resize(std::size_t capacity);
+        void clear();
+
+        std::size_t size() const;
+        std::size_t weight() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+
+        std::size_t hits() const;
+        std::size_t misses() const;
+        std::size_t evictions() const;
+        void reset_statistics();
+
+    private:
+        enum class Segment : std::uint8_t
+        {
+            Window,
+            Probation,
+            Protected
+        };
+
+        struct Entry
+        {
+            template<typename K, typename V>
+            Entry(K&& key, V&& value, std::size_t weight);
+
+            Key key;
+            Value value;
+            std::size_t weight;
+            Segment segment;
+        };
+
+        using List = DoublyLinkedList<Entry>;
+        using Position = typename List::Iterator;
+
+        List _window;
+        List _probation;
+        List _protected;
+        HashMap<Key, Position, Hasher> _map;
+        detail::FrequencySketch _sketch;
+        Hasher _hasher;
+
+        Weigher _weigher;
+        EvictionCallback _callback;
+
+        std::size_t _capacity;
+        std::size_t _windowCapacity;
+        std::size_t _protectedCapacity;
+
+        std::size_t _windowWeight;
+        std::size_t _probationWeight;
+        std::size_t _protectedWeight;
+
+        std::size_t _hits;
+        std::size_t _misses;
+        std::size_t _evictions;
+
+        template<typename K, typename V>
+        bool insert(K&& key, V&& value);
+
+        std::size_t weigh(const Key& key, const Value& value) const;
+        std::uint64_t hash(const Key& key) const;
+        std::size_t& segment_weight(Segment segment);
+        List& segment_list(Segment segment);
+
+        void touch(Position position);
+        void remove(Position position);
+        void evict();
+        void evict_from_main(Position candidate);
+        void set_capacity(std::size_t capacity);
+        void swap(TinyLfuCache<Key, Value, Hasher>& cache);
+    };
+}
+
+inline Dataplex::detail::FrequencySketch::FrequencySketch(std::size_t capacity) :
+    _table(),
+    _capacity(0),
+    _mask(0),
+    _additions(0),
+    _sampleSize(0)
+{
+    ensure_capacity(capacity);
+}
+
+inline void Dataplex::detail::FrequencySketch::increment(std::uint64_t hash)
+{
+    auto added = false;
+
+    for (std::size_t row = 0; row < Depth; ++row)
+    {
+        auto index = counter_index(hash, row);
+        auto& word = _table[index >> 4];
+        auto shift = (index & 15) << 2;
+
+        if (((word >> shift) & 0xF) != 0xF)
+        {
+            word += std::uint64_t(1) << shift;
+            added = true;
+        }
+    }
+
+    if (added && ++_additions == _sampleSize)
+    {
+        age();
+    }
+}
+
+inline std::uint32_t Dataplex::detail::FrequencySketch::frequency(std::uint64_t hash) const
+{
+    std::uint32_t frequency = 0xF;
+
+    for (std::size_t row = 0; row < Depth; ++row)
+    {
+        auto index = counter_index(hash, row);
+        auto count = static_cast<std::uint32_t>((_table[index >> 4] >> ((index & 15) << 2)) & 0xF);
+
+        if (count < frequency)
+        {
+            frequency = count;
+        }
+    }
+
+    return frequency;
+}
+
+inline void Dataplex::detail::FrequencySketch::ensure_capacity(std::size_t capacity)
+{
+    if (capacity <= _capacity && !_table.is_empty())
+    {
+        return;
+    }
+
+    std::size_t words = 1;
+
+    while (words < capacity)
+    {
+        words <<= 1;
+    }
+
+    _capacity = capacity;
+
+    if (words > _table.size())
+    {
+        _table.resize(words);
+        _mask = words * 16 - 1;
+        _sampleSize = 10 * words;
+
+        clear();
+    }
+}
+
+inline void Dataplex::detail::FrequencySketch::clear()
+{
+    for (std::size_t i = 0; i < _table.size(); ++i)
+    {
+        _table[i] = 0;
+    }
+
+    _additions = 0;
+}
+
+inline std::size_t Dataplex::detail::FrequencySketch::capacity() const
+{
+    return _capacity;
+}
+
+inline std::size_t Dataplex::detail::FrequencySketch::counter_index(std::uint64_t hash, std::size_t row) const
+{
+    return static_cast<std::size_t>(hash::mix64(hash, row + 1)) & _mask;
+}
+
+inline void Dataplex::detail::FrequencySketch::age()
+{
+    for (std::size_t i = 0; i < _table.size(); ++i)
+    {
+        _table[i] = (_table[i] >> 1) & 0x7777777777777777ull;
+    }
+
+    _additions /= 2;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::TinyLfuCache<Key, Value, Hasher>::TinyLfuCache(std::size_t capacity, Weigher weigher, const Hasher& hasher) :
+    _window(),
+    _probation(),
+    _protected(),
+    _map(HashMap<Key, Position, Hasher>::Resize::Immediate, hasher),
+    _sketch(weigher ? 64 : capacity),
+    _hasher(hasher),
+    _weigher(std::move(weigher)),
+    _callback(),
+    _capacity(0),
+    _windowCapacity(0),
+    _protectedCapacity(0),
+    _windowWeight(0),
+    _probationWeight(0),
+    _protectedWeight(0),
+    _hits(0),
+    _misses(0),
+    _evictions(0)
+{
+    set_capacity(capacity);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::TinyLfuCache<Key, Value, Hasher>::TinyLfuCache(const TinyLfuCache<Key, Value, Hasher>& cache) :
+    TinyLfuCache(cache._capacity, cache._weigher, cache._hasher)
+{
+    _callback = cache._callback;
+    _sketch = cache._sketch;
+
+    for (const auto* source : { &cache._window, &cache._probation, &cache._protected })
+    {
+        for (auto entry = source->begin(); entry != source->end(); ++entry)
+        {
+            auto& target = segment_list(entry->segment);
+            auto position = target.emplace(target.end(), entry->key, entry->value, entry->weight);
+            position->segment = entry->segment;
+
+            _map.emplace(entry->key, position);
+
+            segment_weight(entry->segment) += entry->weight;
+        }
+    }
+
+    _hits = cache._hits;
+    _misses = cache._misses;
+    _evictions = cache._evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::TinyLfuCache<Key, Value, Hasher>& Dataplex::TinyLfuCache<Key, Value, Hasher>::operator=(const TinyLfuCache<Key, Value, Hasher>& cache)
+{
+    TinyLfuCache<Key, Value, Hasher> temp(cache);
+    swap(temp);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::TinyLfuCache<Key, Value, Hasher>::TinyLfuCache(TinyLfuCache<Key, Value, Hasher>&& cache) :
+    TinyLfuCache(1, Weigher(), cache._hasher)
+{
+    swap(cache);
+}
+
+template<typename Key, typename Value, typename Hasher>
+Dataplex::TinyLfuCache<Key, Value, Hasher>& Dataplex::TinyLfuCache<Key, Value, Hasher>::operator=(TinyLfuCache<Key, Value, Hasher>&& cache)
+{
+    swap(cache);
+
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hasher>
+Value* Dataplex::TinyLfuCache<Key, Value, Hasher>::get(const Key& key)
+{
+    _sketch.increment(hash(key));
+
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        ++_misses;
+
+        return nullptr;
+    }
+
+    ++_hits;
+
+    auto position = found->second;
+
+    touch(position);
+
+    return &position->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+const Value* Dataplex::TinyLfuCache<Key, Value, Hasher>::peek(const Key& key) const
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return nullptr;
+    }
+
+    auto position = found->second;
+
+    return &position->value;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::contains(const Key& key) const
+{
+    return _map.contains(key);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::put(const Key& key, const Value& value)
+{
+    return insert(key, value);
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::put(Key&& key, Value&& value)
+{
+    return insert(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::erase(const Key& key)
+{
+    auto found = _map.find(key);
+
+    if (found == _map.end())
+    {
+        return false;
+    }
+
+    auto position = found->second;
+
+    segment_weight(position->segment) -= position->weight;
+
+    _map.erase(key);
+    segment_list(position->segment).erase(position);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::set_eviction_callback(EvictionCallback callback)
+{
+    _callback = std::move(callback);
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::resize(std::size_t capacity)
+{
+    set_capacity(capacity);
+
+    if (!_weigher)
+    {
+        _sketch.ensure_capacity(capacity);
+    }
+
+    while (_protectedWeight > _protectedCapacity && !_protected.is_empty())
+    {
+        auto position = _map.find(_protected.tail().key)->second;
+
+        _protectedWeight -= position->weight;
+        _probationWeight += position->weight;
+        position->segment = Segment::Probation;
+
+        _probation.splice_front(_protected, position);
+    }
+
+    evict();
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::clear()
+{
+    _window.clear();
+    _probation.clear();
+    _protected.clear();
+    _map.clear();
+    _sketch.clear();
+
+    _windowWeight = 0;
+    _probationWeight = 0;
+    _protectedWeight = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::size() const
+{
+    return _map.size();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::weight() const
+{
+    return _windowWeight + _probationWeight + _protectedWeight;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename Key, typename Value, typename Hasher>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::is_empty() const
+{
+    return _map.is_empty();
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::hits() const
+{
+    return _hits;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::misses() const
+{
+    return _misses;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::evictions() const
+{
+    return _evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::reset_statistics()
+{
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+Dataplex::TinyLfuCache<Key, Value, Hasher>::Entry::Entry(K&& key, V&& value, std::size_t weight) :
+    key(std::forward<K>(key)),
+    value(std::forward<V>(value)),
+    weight(weight),
+    segment(Segment::Window)
+{
+}
+
+template<typename Key, typename Value, typename Hasher>
+template<typename K, typename V>
+bool Dataplex::TinyLfuCache<Key, Value, Hasher>::insert(K&& key, V&& value)
+{
+    auto weight = weigh(key, value);
+
+    if (weight > _capacity)
+    {
+        erase(key);
+
+        return false;
+    }
+
+    auto found = _map.find(key);
+
+    _sketch.increment(hash(key));
+
+    if (found != _map.end())
+    {
+        auto position = found->second;
+
+        segment_weight(position->segment) += weight - position->weight;
+
+        position->value = std::forward<V>(value);
+        position->weight = weight;
+
+        touch(position);
+    }
+    else
+    {
+        _window.emplace_front(key, std::forward<V>(value), weight);
+        _map.emplace(std::forward<K>(key), _window.begin());
+
+        _windowWeight += weight;
+
+        if (_weigher && _map.size() > _sketch.capacity())
+        {
+            _sketch.ensure_capacity(2 * _map.size());
+        }
+    }
+
+    evict();
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t Dataplex::TinyLfuCache<Key, Value, Hasher>::weigh(const Key& key, const Value& value) const
+{
+    return _weigher ? _weigher(key, value) : 1;
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::uint64_t Dataplex::TinyLfuCache<Key, Value, Hasher>::hash(const Key& key) const
+{
+    return static_cast<std::uint64_t>(_hasher(key));
+}
+
+template<typename Key, typename Value, typename Hasher>
+std::size_t& Dataplex::TinyLfuCache<Key, Value, Hasher>::segment_weight(Segment segment)
+{
+    switch (segment)
+    {
+    case Segment::Window:
+        return _windowWeight;
+    case Segment::Probation:
+        return _probationWeight;
+    default:
+        return _protectedWeight;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+typename Dataplex::TinyLfuCache<Key, Value, Hasher>::List& Dataplex::TinyLfuCache<Key, Value, Hasher>::segment_list(Segment segment)
+{
+    switch (segment)
+    {
+    case Segment::Window:
+        return _window;
+    case Segment::Probation:
+        return _probation;
+    default:
+        return _protected;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::touch(Position position)
+{
+    switch (position->segment)
+    {
+    case Segment::Window:
+        _window.move_to_front(position);
+        break;
+    case Segment::Probation:
+        _probationWeight -= position->weight;
+        _protectedWeight += position->weight;
+        position->segment = Segment::Protected;
+
+        _protected.splice_front(_probation, position);
+
+        while (_protectedWeight > _protectedCapacity && _protected.size() > 1)
+        {
+            auto demoted = _map.find(_protected.tail().key)->second;
+
+            _protectedWeight -= demoted->weight;
+            _probationWeight += demoted->weight;
+            demoted->segment = Segment::Probation;
+
+            _probation.splice_front(_protected, demoted);
+        }
+        break;
+    case Segment::Protected:
+        _protected.move_to_front(position);
+        break;
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::remove(Position position)
+{
+    if (_callback)
+    {
+        _callback(position->key, position->value);
+    }
+
+    segment_weight(position->segment) -= position->weight;
+
+    _map.erase(position->key);
+    segment_list(position->segment).erase(position);
+
+    ++_evictions;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::evict()
+{
+    while (_windowWeight > _windowCapacity && !_window.is_empty())
+    {
+        auto candidate = _map.find(_window.tail().key)->second;
+
+        _windowWeight -= candidate->weight;
+        _probationWeight += candidate->weight;
+        candidate->segment = Segment::Probation;
+
+        _probation.splice_front(_window, candidate);
+
+        evict_from_main(candidate);
+    }
+
+    while (weight() > _capacity)
+    {
+        auto& list = !_probation.is_empty() ? _probation : !_protected.is_empty() ? _protected : _window;
+
+        remove(_map.find(list.tail().key)->second);
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::evict_from_main(Position candidate)
+{
+    auto mainCapacity = _capacity - _windowCapacity;
+
+    while (_probationWeight + _protectedWeight > mainCapacity)
+    {
+        Position victim(nullptr);
+
+        if (_probation.size() > 1)
+        {
+            victim = _map.find(_probation.tail().key)->second;
+        }
+        else if (!_protected.is_empty())
+        {
+            victim = _map.find(_protected.tail().key)->second;
+        }
+        else
+        {
+            remove(candidate);
+
+            return;
+        }
+
+        if (_sketch.frequency(hash(candidate->key)) > _sketch.frequency(hash(victim->key)))
+        {
+            remove(victim);
+        }
+        else
+        {
+            remove(candidate);
+
+            return;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::set_capacity(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Cache capacity must be greater than zero!");
+    }
+
+    _capacity = capacity;
+    _windowCapacity = capacity > 100 ? capacity / 100 : 1;
+    _protectedCapacity = (capacity - _windowCapacity) * 4 / 5;
+}
+
+template<typename Key, typename Value, typename Hasher>
+void Dataplex::TinyLfuCache<Key, Value, Hasher>::swap(TinyLfuCache<Key, Value, Hasher>& cache)
+{
+    using std::swap;
+
+    swap(_window, cache._window);
+    swap(_probation, cache._probation);
+    swap(_protected, cache._protected);
+    swap(_map, cache._map);
+    swap(_sketch, cache._sketch);
+    swap(_hasher, cache._hasher);
+    swap(_weigher, cache._weigher);
+    swap(_callback, cache._callback);
+    swap(_capacity, cache._capacity);
+    swap(_windowCapacity, cache._windowCapacity);
+    swap(_protectedCapacity, cache._protectedCapacity);
+    swap(_windowWeight, cache._windowWeight);
+    swap(_probationWeight, cache._probationWeight);
+    swap(_protectedWeight, cache._protectedWeight);
+    swap(_hits, cache._hits);
+    swap(_misses, cache._misses);
+    swap(_evictions, cache._evictions);
+}
@@ -0,0 +1,70 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Utility.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        struct EmptyValue
+        {
+        };
+
+        template<typename T>
+        class ScratchBuffer
+        {
+        public:
+            template<typename InputIt>
+            ScratchBuffer(InputIt first, std::size_t size);
+            ScratchBuffer(const ScratchBuffer<T>& buffer) = delete;
+            ScratchBuffer<T>& operator=(const ScratchBuffer<T>& buffer) = delete;
+
+            ~ScratchBuffer();
+
+            T* get() const;
+
+        private:
+            T* _array;
+            std::size_t _size;
+        };
+    }
+}
+
+template<typename T>
+template<typename InputIt>
+Dataplex::detail::ScratchBuffer<T>::ScratchBuffer(InputIt first, std::size_t size) :
+    _array(std::allocator<T>().allocate(size)),
+    _size(size)
+{
+    try
+    {
+        std::uninitialized_move_n(first, size, _array);
+    }
+    catch (...)
+    {
+        std::allocator<T>().deallocate(_array, _size);
+        throw;
+    }
+}
+
+template<typename T>
+Dataplex::detail::ScratchBuffer<T>::~ScratchBuffer()
+{
+    std::destroy_n(_array, _size);
+    std::allocator<T>().deallocate(_array, _size);
+}
+
+template<typename T>
+T* Dataplex::detail::ScratchBuffer<T>::get() const
+{
+    return _array;
+}
@@ -0,0 +1,293 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - WorkStealingDeque.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include "DynamicArray.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+
+namespace Dataplex
+{
+    namespace detail
+    {
+        template<typename T>
+        struct is_always_lock_free
+        {
+            static constexpr bool value = std::atomic<T>::is_always_lock_free;
+        };
+
+        template<typename T>
+        constexpr bool is_inline_work = std::conjunction<std::is_trivially_copyable<T>, is_always_lock_free<T>>::value;
+    }
+
+    template<typename T>
+    class WorkStealingDeque
+    {
+    public:
+        explicit WorkStealingDeque(std::size_t capacity = 64);
+        WorkStealingDeque(const WorkStealingDeque<T>& deque) = delete;
+        WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>& deque) = delete;
+
+        ~WorkStealingDeque();
+
+        void push(const T& data);
+        void push(T&& data);
+
+        template<typename... Args>
+        void emplace(Args&&... args);
+
+        bool try_pop(T& data);
+        bool try_steal(T& data);
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool is_empty() const;
+
+    private:
+        using Stored = std::conditional_t<detail::is_inline_work<T>, T, T*>;
+
+        struct Buffer
+        {
+            explicit Buffer(std::int64_t capacity);
+
+            Stored get(std::int64_t index) const;
+            void put(std::int64_t index, Stored data);
+
+            std::int64_t capacity;
+            std::unique_ptr<std::atomic<Stored>[]> slots;
+        };
+
+        alignas(64) std::atomic<std::int64_t> _top;
+        alignas(64) std::atomic<std::int64_t> _bottom;
+        alignas(64) std::atomic<Buffer*> _buffer;
+        DynamicArray<std::unique_ptr<Buffer>> _retired;
+
+        void push_stored(Stored data);
+
+        static void take(Stored stored, T& data);
+        static void destroy(Stored stored);
+    };
+}
+
+template<typename T>
+Dataplex::WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity) :
+    _top(0),
+    _bottom(0),
+    _buffer(nullptr),
+    _retired()
+{
+    std::int64_t size = 2;
+
+    while (size < static_cast<std::int64_t>(capacity))
+    {
+        size *= 2;
+    }
+
+    _buffer.store(new Buffer(size), std::memory_order_relaxed);
+}
+
+template<typename T>
+Dataplex::WorkStealingDeque<T>::~WorkStealingDeque()
+{
+    auto buffer = _buffer.load(std::memory_order_relaxed);
+    auto bottom = _bottom.load(std::memory_order_relaxed);
+
+    for (auto i = _top.load(std::memory_order_relaxed); i < bottom; ++i)
+    {
+        destroy(buffer->get(i));
+    }
+
+    delete buffer;
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::push(const T& data)
+{
+    emplace(data);
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::push(T&& data)
+{
+    emplace(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+void Dataplex::WorkStealingDeque<T>::emplace(Args&&... args)
+{
+    if constexpr (detail::is_inline_work<T>)
+    {
+        push_stored(T(std::forward<Args>(args)...));
+    }
+    else
+    {
+        auto data = std::make_unique<T>(std::forward<Args>(args)...);
+
+        push_stored(data.get());
+        data.release();
+    }
+}
+
+template<typename T>
+bool Dataplex::WorkStealingDeque<T>::try_pop(T& data)
+{
+    auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    auto buffer = _buffer.load(std::memory_order_relaxed);
+
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return false;
+    }
+
+    auto stored = buffer->get(bottom);
+
+    if (top == bottom)
+    {
+        auto won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        if (!won)
+        {
+            return false;
+        }
+    }
+
+    take(stored, data);
+
+    return true;
+}
+
+template<typename T>
+bool Dataplex::WorkStealingDeque<T>::try_steal(T& data)
+{
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    auto stored = _buffer.load(std::memory_order_acquire)->get(top);
+
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    take(stored, data);
+
+    return true;
+}
+
+template<typename T>
+std::size_t Dataplex::WorkStealingDeque<T>::size() const
+{
+    auto bottom = _bottom.load(std::memory_order_relaxed);
+    auto top = _top.load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+template<typename T>
+std::size_t Dataplex::WorkStealingDeque<T>::capacity() const
+{
+    return static_cast<std::size_t>(_buffer.load(std::memory_order_relaxed)->capacity);
+}
+
+template<typename T>
+bool Dataplex::WorkStealingDeque<T>::is_empty() const
+{
+    return size() == 0;
+}
+
+template<typename T>
+Dataplex::WorkStealingDeque<T>::Buffer::Buffer(std::int64_t capacity) :
+    capacity(capacity),
+    slots(new std::atomic<Stored>[capacity])
+{
+}
+
+template<typename T>
+typename Dataplex::WorkStealingDeque<T>::Stored Dataplex::WorkStealingDeque<T>::Buffer::get(std::int64_t index) const
+{
+    return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::Buffer::put(std::int64_t index, Stored data)
+{
+    slots[index & (capacity - 1)].store(data, std::memory_order_relaxed);
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::push_stored(Stored data)
+{
+    auto bottom = _bottom.load(std::memory_order_relaxed);
+    auto top = _top.load(std::memory_order_acquire);
+    auto buffer = _buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > buffer->capacity - 1)
+    {
+        auto grown = std::make_unique<Buffer>(buffer->capacity * 2);
+
+        for (auto i = top; i < bottom; ++i)
+        {
+            grown->put(i, buffer->get(i));
+        }
+
+        _retired.emplace_back(buffer);
+        _buffer.store(grown.get(), std::memory_order_release);
+
+        buffer = grown.release();
+    }
+
+    buffer->put(bottom, data);
+
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::take(Stored stored, T& data)
+{
+    if constexpr (detail::is_inline_work<T>)
+    {
+        data = stored;
+    }
+    else
+    {
+        std::unique_ptr<T> owned(stored);
+
+        data = std::move(*owned);
+    }
+}
+
+template<typename T>
+void Dataplex::WorkStealingDeque<T>::destroy(Stored stored)
+{
+    if constexpr (!detail::is_inline_work<T>)
+    {
+        delete stored;
+    }
+}
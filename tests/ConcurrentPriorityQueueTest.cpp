@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentPriorityQueueTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "ConcurrentPriorityQueue.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace
+{
+    constexpr std::size_t ProducerCount = 8;
+    constexpr std::size_t ConsumerCount = 8;
+    constexpr std::size_t ValuesPerProducer = 10000;
+    constexpr std::size_t ValueCount = ProducerCount * ValuesPerProducer;
+
+    template<typename Queue>
+    void check_exactly_once(Queue& queue)
+    {
+        std::unique_ptr<std::atomic<std::size_t>[]> seen(new std::atomic<std::size_t>[ValueCount]());
+        std::atomic<std::size_t> popped(0);
+
+        Dataplex::test::run_threads(ProducerCount + ConsumerCount, [&](std::size_t thread)
+            {
+                if (thread < ProducerCount)
+                {
+                    for (std::size_t i = 0; i < ValuesPerProducer; ++i)
+                    {
+                        queue.push(static_cast<std::uint64_t>(i * ProducerCount + thread));
+                    }
+
+                    return;
+                }
+
+                std::uint64_t value = 0;
+
+                while (popped.load(std::memory_order_relaxed) < ValueCount)
+                {
+                    if (queue.try_pop(value))
+                    {
+                        DATAPLEX_CHECK(value < ValueCount);
+                        seen[value].fetch_add(1, std::memory_order_relaxed);
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            DATAPLEX_CHECK(seen[i].load() == 1);
+        }
+
+        std::uint64_t value = 0;
+
+        DATAPLEX_CHECK(queue.size() == 0);
+        DATAPLEX_CHECK(queue.is_empty());
+        DATAPLEX_CHECK(!queue.try_pop(value));
+    }
+
+    void test_locked_ordering()
+    {
+        Dataplex::LockedPriorityQueue<int> maxQueue;
+        Dataplex::LockedPriorityQueue<int, std::greater<int>> minQueue;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto value = (i * 7919) % 1000;
+
+            maxQueue.push(value);
+            minQueue.emplace(value);
+        }
+
+        DATAPLEX_CHECK(maxQueue.size() == 1000);
+
+        int value = 0;
+
+        for (int expected = 999; expected >= 0; --expected)
+        {
+            DATAPLEX_CHECK(maxQueue.try_pop(value) && value == expected);
+        }
+
+        for (int expected = 0; expected < 1000; ++expected)
+        {
+            DATAPLEX_CHECK(minQueue.try_pop(value) && value == expected);
+        }
+
+        DATAPLEX_CHECK(maxQueue.is_empty() && minQueue.is_empty());
+        DATAPLEX_CHECK(!maxQueue.try_pop(value));
+    }
+
+    void test_multi_queue_drains()
+    {
+        Dataplex::MultiQueue<int> queue(4);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            queue.push(i);
+        }
+
+        DATAPLEX_CHECK(queue.size() == 1000);
+
+        int value = 0;
+        std::size_t popped = 0;
+
+        while (queue.try_pop(value))
+        {
+            ++popped;
+        }
+
+        DATAPLEX_CHECK(popped == 1000);
+        DATAPLEX_CHECK(queue.is_empty());
+    }
+
+    void test_locked_exactly_once()
+    {
+        Dataplex::LockedPriorityQueue<std::uint64_t> queue;
+
+        check_exactly_once(queue);
+    }
+
+    void test_multi_queue_exactly_once()
+    {
+        Dataplex::MultiQueue<std::uint64_t> queue(ProducerCount + ConsumerCount);
+
+        check_exactly_once(queue);
+    }
+}
+
+int main()
+{
+    test_locked_ordering();
+    test_multi_queue_drains();
+    test_locked_exactly_once();
+    test_multi_queue_exactly_once();
+}
@@ -0,0 +1,242 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ConcurrentSkipListMapTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "ConcurrentSkipListMap.hpp"
+
+#include <set>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+
+namespace
+{
+    constexpr std::size_t ThreadCount = 16;
+    constexpr std::size_t KeysPerThread = 2000;
+    constexpr std::size_t KeyCount = ThreadCount * KeysPerThread;
+    constexpr std::size_t SharedKeyCount = 4000;
+
+    using Map = Dataplex::ConcurrentSkipListMap<std::uint64_t, std::uint64_t>;
+
+    std::uint64_t next_random(std::uint64_t& seed)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        return seed;
+    }
+
+    void check_matches(const Map& map, const std::set<std::uint64_t>& reference)
+    {
+        DATAPLEX_CHECK(map.size() == reference.size());
+
+        auto expected = reference.begin();
+
+        for (auto entry : map)
+        {
+            DATAPLEX_CHECK(expected != reference.end());
+            DATAPLEX_CHECK(entry.first == *expected);
+            DATAPLEX_CHECK(entry.second == entry.first * 2);
+
+            ++expected;
+        }
+
+        DATAPLEX_CHECK(expected == reference.end());
+    }
+
+    void test_disjoint_writers()
+    {
+        Map map;
+
+        Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+            {
+                for (std::size_t i = 0; i < KeysPerThread; ++i)
+                {
+                    std::uint64_t key = i * ThreadCount + thread;
+
+                    DATAPLEX_CHECK(map.insert(key, key * 2));
+                }
+
+                for (std::size_t i = 0; i < KeysPerThread; i += 2)
+                {
+                    DATAPLEX_CHECK(map.erase(i * ThreadCount + thread));
+                }
+            });
+
+        std::set<std::uint64_t> reference;
+
+        for (std::size_t i = 1; i < KeysPerThread; i += 2)
+        {
+            for (std::size_t thread = 0; thread < ThreadCount; ++thread)
+            {
+                reference.insert(i * ThreadCount + thread);
+            }
+        }
+
+        check_matches(map, reference);
+
+        for (std::uint64_t key = 0; key < KeyCount; ++key)
+        {
+            auto found = map.find(key);
+
+            DATAPLEX_CHECK((found != map.end()) == (reference.count(key) == 1));
+        }
+    }
+
+    void test_overlapping_writers()
+    {
+        Map map;
+        std::atomic<std::size_t> inserted(0);
+        std::atomic<std::size_t> erased(0);
+
+        Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+            {
+                for (std::size_t i = 0; i < SharedKeyCount; ++i)
+                {
+                    std::uint64_t key = (i + thread * 7) % SharedKeyCount;
+
+                    if (map.insert(key, key * 2))
+                    {
+                        inserted.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+        DATAPLEX_CHECK(inserted.load() == SharedKeyCount);
+
+        std::set<std::uint64_t> reference;
+
+        for (std::uint64_t key = 0; key < SharedKeyCount; ++key)
+        {
+            reference.insert(key);
+        }
+
+        check_matches(map, reference);
+
+        Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+            {
+                for (std::size_t i = 0; i < SharedKeyCount; ++i)
+                {
+                    std::uint64_t key = (i + thread * 13) % SharedKeyCount;
+
+                    if (key % 3 != 0 && map.erase(key))
+                    {
+                        erased.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+        for (auto key = reference.begin(); key != reference.end();)
+        {
+            key = *key % 3 != 0 ? reference.erase(key) : std::next(key);
+        }
+
+        DATAPLEX_CHECK(erased.load() == SharedKeyCount - reference.size());
+
+        check_matches(map, reference);
+    }
+
+    void test_reads_during_writes()
+    {
+        constexpr std::uint64_t Stride = 4;
+        constexpr std::uint64_t KeyRange = SharedKeyCount * Stride;
+
+        Map map;
+
+        for (std::uint64_t key = 0; key < KeyRange; key += Stride)
+        {
+            map.insert(key, key * 2);
+        }
+
+        std::atomic<std::size_t> writersDone(0);
+        constexpr std::size_t WriterCount = ThreadCount / 2;
+
+        Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+            {
+                std::uint64_t seed = thread * 0x9E3779B97F4A7C15 + 1;
+
+                if (thread < WriterCount)
+                {
+                    for (std::size_t i = 0; i < KeysPerThread * 4; ++i)
+                    {
+                        auto key = next_random(seed) % KeyRange;
+
+                        if (key % Stride == 0)
+                        {
+                            continue;
+                        }
+
+                        if (i % 2 == 0)
+                        {
+                            map.insert(key, key * 2);
+                        }
+                        else
+                        {
+                            map.erase(key);
+                        }
+                    }
+
+                    writersDone.fetch_add(1, std::memory_order_release);
+
+                    return;
+                }
+
+                while (writersDone.load(std::memory_order_acquire) != WriterCount)
+                {
+                    auto key = next_random(seed) % (KeyRange - Stride);
+                    auto found = map.lower_bound(key);
+
+                    DATAPLEX_CHECK(found != map.end());
+                    DATAPLEX_CHECK((*found).first >= key);
+                    DATAPLEX_CHECK((*found).first <= (key + Stride - 1) / Stride * Stride);
+                    DATAPLEX_CHECK((*found).second == (*found).first * 2);
+
+                    std::uint64_t previous = (*found).first;
+                    std::uint64_t nextStable = (previous + Stride - 1) / Stride * Stride;
+                    std::size_t steps = 0;
+
+                    for (auto it = found; it != map.end() && steps < 32; ++it, ++steps)
+                    {
+                        auto current = (*it).first;
+
+                        DATAPLEX_CHECK(steps == 0 || current > previous);
+                        DATAPLEX_CHECK(current <= nextStable);
+
+                        if (current == nextStable)
+                        {
+                            nextStable += Stride;
+                        }
+
+                        previous = current;
+                    }
+                }
+            });
+
+        std::size_t stable = 0;
+
+        for (auto entry : map)
+        {
+            if (entry.first % Stride == 0)
+            {
+                ++stable;
+            }
+        }
+
+        DATAPLEX_CHECK(stable == SharedKeyCount);
+    }
+}
+
+int main()
+{
+    test_disjoint_writers();
+    test_overlapping_writers();
+    test_reads_during_writes();
+}
@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - ReclamationTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "Reclamation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+    constexpr std::size_t ThreadCount = 32;
+    constexpr std::size_t Iterations = 4000;
+    constexpr std::uint64_t Guard = 0x5DEECE66D;
+
+    std::atomic<std::size_t> created(0);
+    std::atomic<std::size_t> destroyed(0);
+
+    struct Node
+    {
+        explicit Node(std::uint64_t value) :
+            value(value),
+            check(value ^ Guard)
+        {
+            created.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ~Node()
+        {
+            check = 0;
+            destroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::uint64_t value;
+        std::uint64_t check;
+    };
+
+    void test_epoch_churn()
+    {
+        created = 0;
+        destroyed = 0;
+
+        {
+            Dataplex::EpochManager manager;
+            std::atomic<Node*> shared(new Node(0));
+
+            Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+                {
+                    for (std::size_t i = 0; i < Iterations; ++i)
+                    {
+                        Dataplex::EpochGuard guard(manager);
+
+                        auto node = shared.load(std::memory_order_acquire);
+
+                        DATAPLEX_CHECK(node->check == (node->value ^ Guard));
+
+                        if ((i + thread) % 4 == 0)
+                        {
+                            auto old = shared.exchange(new Node(thread * Iterations + i), std::memory_order_acq_rel);
+
+                            manager.retire(old);
+                        }
+                    }
+
+                    manager.collect();
+                });
+
+            delete shared.load();
+        }
+
+        DATAPLEX_CHECK(created.load() == destroyed.load());
+    }
+
+    void test_nested_pins()
+    {
+        Dataplex::EpochManager manager;
+
+        created = 0;
+        destroyed = 0;
+
+        {
+            Dataplex::EpochGuard outer(manager);
+            Dataplex::EpochGuard inner(outer);
+
+            manager.retire(new Node(1));
+
+            for (std::size_t i = 0; i < 8; ++i)
+            {
+                manager.collect();
+            }
+
+            DATAPLEX_CHECK(destroyed.load() == 0);
+        }
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            manager.collect();
+        }
+
+        DATAPLEX_CHECK(destroyed.load() == 1);
+    }
+
+    void test_hazard_churn()
+    {
+        created = 0;
+        destroyed = 0;
+
+        {
+            Dataplex::HazardPointerDomain domain;
+            std::atomic<Node*> shared(new Node(0));
+
+            Dataplex::test::run_threads(ThreadCount, [&](std::size_t thread)
+                {
+                    Dataplex::HazardPointer hazard(domain);
+
+                    for (std::size_t i = 0; i < Iterations; ++i)
+                    {
+                        auto node = hazard.protect(shared);
+
+                        DATAPLEX_CHECK(node->check == (node->value ^ Guard));
+
+                        hazard.reset();
+
+                        if ((i + thread) % 4 == 0)
+                        {
+                            auto old = shared.exchange(new Node(thread * Iterations + i), std::memory_order_acq_rel);
+
+                            domain.retire(old);
+                        }
+                    }
+                });
+
+            domain.collect();
+
+            DATAPLEX_CHECK(domain.retired_count() == 0);
+
+            delete shared.load();
+        }
+
+        DATAPLEX_CHECK(created.load() == destroyed.load());
+    }
+
+    void test_hazard_protects()
+    {
+        Dataplex::HazardPointerDomain domain;
+        std::atomic<Node*> shared(new Node(7));
+
+        created = 1;
+        destroyed = 0;
+
+        {
+            Dataplex::HazardPointer hazard(domain);
+
+            auto node = hazard.protect(shared);
+
+            shared.store(new Node(8));
+            domain.retire(node);
+            domain.collect();
+
+            DATAPLEX_CHECK(destroyed.load() == 0);
+            DATAPLEX_CHECK(node->value == 7);
+        }
+
+        domain.collect();
+
+        DATAPLEX_CHECK(destroyed.load() == 1);
+
+        delete shared.load();
+    }
+}
+
+int main()
+{
+    test_epoch_churn();
+    test_nested_pins();
+    test_hazard_churn();
+    test_hazard_protects();
+}
@@ -0,0 +1,135 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - SharedArrayTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "SharedArray.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+
+namespace
+{
+    constexpr std::size_t ThreadCount = 8;
+    constexpr std::size_t Iterations = 2000;
+    constexpr std::size_t ElementCount = 64;
+
+    void test_copy_on_write()
+    {
+        Dataplex::SharedArray<int> array{ 1, 2, 3 };
+        auto snapshot = array.snapshot();
+
+        DATAPLEX_CHECK(array.is_shared());
+
+        array.push_back(4);
+
+        DATAPLEX_CHECK(!array.is_shared());
+        DATAPLEX_CHECK(snapshot.size() == 3);
+        DATAPLEX_CHECK(array.size() == 4);
+    }
+
+    void test_reference_does_not_reach_snapshot()
+    {
+        Dataplex::SharedArray<int> array;
+        array.push_back(1);
+
+        auto& reference = array[0];
+        auto snapshot = array.snapshot();
+
+        reference = 42;
+
+        DATAPLEX_CHECK(!array.is_shared());
+        DATAPLEX_CHECK(snapshot[0] == 1);
+        DATAPLEX_CHECK(array[0] == 42);
+    }
+
+    void test_iterator_does_not_reach_copy()
+    {
+        Dataplex::SharedArray<int> array{ 1, 2, 3 };
+        auto iterator = array.begin();
+
+        Dataplex::SharedArray<int> copy(array);
+        Dataplex::SharedArray<int> assigned;
+        assigned = array;
+
+        *iterator = 7;
+
+        DATAPLEX_CHECK(copy[0] == 1);
+        DATAPLEX_CHECK(assigned[0] == 1);
+        DATAPLEX_CHECK(array[0] == 7);
+    }
+
+    void test_sharable_after_reallocation()
+    {
+        Dataplex::SharedArray<int> array{ 1, 2, 3 };
+
+        array[0] = 5;
+        array.shrink_to_fit();
+        array.reserve(16);
+
+        auto snapshot = array.snapshot();
+
+        DATAPLEX_CHECK(array.is_shared());
+        DATAPLEX_CHECK(snapshot[0] == 5);
+    }
+
+    void test_snapshots_across_threads()
+    {
+        Dataplex::SharedArray<std::size_t> array;
+
+        for (std::size_t i = 0; i < ElementCount; ++i)
+        {
+            array.push_back(0);
+        }
+
+        auto& counter = array[0];
+        Dataplex::SharedArray<std::size_t> snapshots[ThreadCount];
+
+        for (auto& snapshot : snapshots)
+        {
+            snapshot = array.snapshot();
+        }
+
+        std::atomic<bool> failed(false);
+
+        Dataplex::test::run_threads(ThreadCount + 1, [&](std::size_t thread)
+            {
+                if (thread == ThreadCount)
+                {
+                    for (std::size_t i = 0; i < Iterations; ++i)
+                    {
+                        ++counter;
+                    }
+
+                    return;
+                }
+
+                const auto& snapshot = snapshots[thread];
+
+                for (std::size_t i = 0; i < Iterations; ++i)
+                {
+                    if (snapshot[0] != 0)
+                    {
+                        failed = true;
+                    }
+                }
+            });
+
+        DATAPLEX_CHECK(!failed);
+        DATAPLEX_CHECK(array[0] == Iterations);
+    }
+}
+
+int main()
+{
+    test_copy_on_write();
+    test_reference_does_not_reach_snapshot();
+    test_iterator_does_not_reach_copy();
+    test_sharable_after_reallocation();
+    test_snapshots_across_threads();
+}
@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - Test.hpp
+http://inversepalindrome.com
+*/
+
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+
+
+#define DATAPLEX_CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << #condition << std::endl; \
+            std::exit(EXIT_FAILURE); \
+        } \
+    } while (false)
+
+
+namespace Dataplex
+{
+    namespace test
+    {
+        template<typename Function>
+        void run_threads(std::size_t threadCount, Function function);
+    }
+}
+
+template<typename Function>
+void Dataplex::test::run_threads(std::size_t threadCount, Function function)
+{
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&function, i]() { function(i); });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
@@ -0,0 +1,218 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - TimerWheelTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "TimerWheel.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+
+namespace
+{
+    constexpr std::size_t Operations = 200000;
+
+    struct Event
+    {
+        explicit Event(std::size_t id) :
+            id(id)
+        {
+        }
+
+        const std::size_t id;
+    };
+
+    std::uint64_t next_random(std::uint64_t& seed)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        return seed;
+    }
+
+    std::uint64_t random_delay(std::uint64_t& seed)
+    {
+        auto random = next_random(seed);
+
+        switch (random % 4)
+        {
+        case 0:
+            return random >> 58;
+        case 1:
+            return (random >> 8) % 5000;
+        case 2:
+            return (random >> 8) % 500000;
+        default:
+            return (random >> 8) % (std::uint64_t(1) << 36);
+        }
+    }
+
+    void test_matches_reference()
+    {
+        using Handle = Dataplex::TimerWheel<Event>::Handle;
+
+        Dataplex::TimerWheel<Event> wheel(12345);
+        std::map<std::pair<std::uint64_t, std::size_t>, Handle> reference;
+        std::vector<std::pair<std::uint64_t, Handle>> handles;
+        std::uint64_t seed = 0x2545F4914F6CDD1D;
+        std::size_t expiredTotal = 0;
+
+        auto deadline_after = [&](std::uint64_t delay)
+        {
+            return wheel.now() + (delay == 0 ? 1 : delay);
+        };
+
+        for (std::size_t id = 0; id < Operations; ++id)
+        {
+            auto action = next_random(seed) % 8;
+
+            if (action < 4 || handles.empty())
+            {
+                auto delay = random_delay(seed);
+                auto deadline = deadline_after(delay);
+                auto handle = wheel.schedule(delay, Event(id));
+
+                DATAPLEX_CHECK(wheel.deadline(handle) == deadline);
+
+                reference.emplace(std::make_pair(deadline, id), handle);
+                handles.emplace_back(id, handle);
+            }
+            else if (action < 6)
+            {
+                auto pick = next_random(seed) % handles.size();
+                auto handle = handles[pick].second;
+                auto live = wheel.contains(handle);
+
+                if (live)
+                {
+                    reference.erase(std::make_pair(wheel.deadline(handle), handles[pick].first));
+                }
+
+                DATAPLEX_CHECK(wheel.cancel(handle) == live);
+                DATAPLEX_CHECK(!wheel.contains(handle));
+                DATAPLEX_CHECK(!wheel.cancel(handle));
+            }
+            else if (action < 7)
+            {
+                auto pick = next_random(seed) % handles.size();
+                auto handle = handles[pick].second;
+
+                if (wheel.contains(handle))
+                {
+                    auto delay = random_delay(seed);
+
+                    reference.erase(std::make_pair(wheel.deadline(handle), handles[pick].first));
+                    reference.emplace(std::make_pair(deadline_after(delay), handles[pick].first), handle);
+
+                    DATAPLEX_CHECK(wheel.reschedule(handle, delay));
+                }
+            }
+            else
+            {
+                auto ticks = next_random(seed) % (id % 1000 == 0 ? std::uint64_t(1) << 30 : 3000);
+                auto target = wheel.now() + ticks;
+                std::vector<Handle> firedHandles;
+
+                auto expired = wheel.advance(ticks, [&](const Event& event)
+                    {
+                        auto found = reference.find(std::make_pair(wheel.now(), event.id));
+
+                        DATAPLEX_CHECK(found != reference.end());
+                        DATAPLEX_CHECK(reference.begin()->first.first == wheel.now());
+                        DATAPLEX_CHECK(wheel.now() <= target);
+
+                        firedHandles.push_back(found->second);
+                        reference.erase(found);
+                    });
+
+                for (auto handle : firedHandles)
+                {
+                    DATAPLEX_CHECK(!wheel.contains(handle));
+                }
+
+                auto fired = firedHandles.size();
+
+                DATAPLEX_CHECK(expired == fired);
+                DATAPLEX_CHECK(wheel.now() == target);
+                DATAPLEX_CHECK(reference.empty() || reference.begin()->first.first > target);
+
+                expiredTotal += fired;
+            }
+
+            DATAPLEX_CHECK(wheel.size() == reference.size());
+        }
+
+        DATAPLEX_CHECK(expiredTotal > 0);
+
+        auto remaining = wheel.size();
+
+        DATAPLEX_CHECK(wheel.advance(UINT64_MAX, [](const Event&) {}) == remaining);
+        DATAPLEX_CHECK(wheel.is_empty());
+    }
+
+    void test_expiry_order_across_levels()
+    {
+        Dataplex::TimerWheel<std::size_t> wheel;
+        std::vector<std::uint64_t> delays = { 1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262145,
+            std::uint64_t(1) << 24, (std::uint64_t(1) << 30) + 7, (std::uint64_t(1) << 36) + 1 };
+
+        for (auto i = delays.size(); i-- > 0;)
+        {
+            wheel.schedule(delays[i], i);
+        }
+
+        std::size_t expected = 0;
+
+        wheel.advance(UINT64_MAX - 1, [&](std::size_t index)
+            {
+                DATAPLEX_CHECK(index == expected);
+                DATAPLEX_CHECK(wheel.now() == delays[index]);
+
+                ++expected;
+            });
+
+        DATAPLEX_CHECK(expected == delays.size());
+    }
+
+    void test_stale_handles()
+    {
+        Dataplex::TimerWheel<std::unique_ptr<int>> wheel;
+
+        auto first = wheel.schedule(10, std::make_unique<int>(1));
+
+        DATAPLEX_CHECK(wheel.cancel(first));
+
+        auto second = wheel.schedule(10, std::make_unique<int>(2));
+
+        DATAPLEX_CHECK((first & UINT32_MAX) == (second & UINT32_MAX));
+        DATAPLEX_CHECK(!wheel.contains(first));
+        DATAPLEX_CHECK(!wheel.cancel(first));
+        DATAPLEX_CHECK(!wheel.reschedule(first, 5));
+        DATAPLEX_CHECK(wheel.contains(second));
+
+        int fired = 0;
+
+        wheel.advance(10, [&](std::unique_ptr<int>& data) { fired = *data; });
+
+        DATAPLEX_CHECK(fired == 2);
+        DATAPLEX_CHECK(!wheel.contains(second));
+        DATAPLEX_CHECK(!wheel.cancel(second));
+    }
+}
+
+int main()
+{
+    test_matches_reference();
+    test_expiry_order_across_levels();
+    test_stale_handles();
+}
@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2019 Inverse Palindrome
+Dataplex - WorkStealingDequeTest.cpp
+http://inversepalindrome.com
+*/
+
+
+#include "Test.hpp"
+
+#include "WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+
+namespace
+{
+    constexpr std::size_t ThiefCount = 7;
+    constexpr std::size_t TaskCount = 200000;
+
+    std::size_t value_of(std::size_t task)
+    {
+        return task;
+    }
+
+    std::size_t value_of(const std::unique_ptr<std::size_t>& task)
+    {
+        return *task;
+    }
+
+    template<typename T, typename MakeTask>
+    void check_exactly_once(MakeTask makeTask)
+    {
+        Dataplex::WorkStealingDeque<T> deque(2);
+        std::unique_ptr<std::atomic<std::size_t>[]> seen(new std::atomic<std::size_t>[TaskCount]());
+        std::atomic<bool> done(false);
+
+        auto record = [&](const T& task)
+        {
+            auto value = value_of(task);
+
+            DATAPLEX_CHECK(value < TaskCount);
+            seen[value].fetch_add(1, std::memory_order_relaxed);
+        };
+
+        Dataplex::test::run_threads(ThiefCount + 1, [&](std::size_t thread)
+            {
+                T task;
+
+                if (thread == 0)
+                {
+                    for (std::size_t i = 0; i < TaskCount; ++i)
+                    {
+                        deque.push(makeTask(i));
+
+                        if (i % 3 == 0 && deque.try_pop(task))
+                        {
+                            record(task);
+                        }
+                    }
+
+                    while (deque.try_pop(task))
+                    {
+                        record(task);
+                    }
+
+                    done.store(true, std::memory_order_release);
+                }
+                else
+                {
+                    while (true)
+                    {
+                        if (deque.try_steal(task))
+                        {
+                            record(task);
+                        }
+                        else if (done.load(std::memory_order_acquire))
+                        {
+                            break;
+                        }
+                    }
+                }
+            });
+
+        for (std::size_t i = 0; i < TaskCount; ++i)
+        {
+            DATAPLEX_CHECK(seen[i].load() == 1);
+        }
+
+        DATAPLEX_CHECK(deque.is_empty());
+        DATAPLEX_CHECK(deque.capacity() > 2);
+    }
+
+    void test_owner_order()
+    {
+        Dataplex::WorkStealingDeque<int> deque(2);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            deque.push(i);
+        }
+
+        DATAPLEX_CHECK(deque.size() == 100);
+        DATAPLEX_CHECK(deque.capacity() >= 100);
+
+        int value = -1;
+
+        DATAPLEX_CHECK(deque.try_pop(value) && value == 99);
+        DATAPLEX_CHECK(deque.try_steal(value) && value == 0);
+        DATAPLEX_CHECK(deque.try_steal(value) && value == 1);
+        DATAPLEX_CHECK(deque.try_pop(value) && value == 98);
+        DATAPLEX_CHECK(deque.size() == 96);
+
+        while (deque.try_pop(value))
+        {
+        }
+
+        DATAPLEX_CHECK(deque.is_empty());
+        DATAPLEX_CHECK(!deque.try_steal(value));
+    }
+
+    void test_move_only()
+    {
+        Dataplex::WorkStealingDeque<std::unique_ptr<std::size_t>> deque(2);
+
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            deque.emplace(new std::size_t(i));
+        }
+
+        std::unique_ptr<std::size_t> task;
+
+        DATAPLEX_CHECK(deque.try_pop(task) && *task == 9);
+        DATAPLEX_CHECK(deque.try_steal(task) && *task == 0);
+        DATAPLEX_CHECK(deque.size() == 8);
+    }
+
+    void test_concurrent_steals()
+    {
+        check_exactly_once<std::size_t>([](std::size_t i) { return i; });
+    }
+
+    void test_concurrent_move_only_steals()
+    {
+        check_exactly_once<std::unique_ptr<std::size_t>>([](std::size_t i) { return std::make_unique<std::size_t>(i); });
+    }
+}
+
+int main()
+{
+    test_owner_order();
+    test_move_only();
+    test_concurrent_steals();
+    test_concurrent_move_only_steals();
+}